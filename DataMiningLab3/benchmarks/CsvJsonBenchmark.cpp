@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+
+#include "DataGetter/CsvDataGetter.hpp"
+#include "DataGetter/JsonDataGetter.hpp"
+
+// Load throughput of the same points as CSV and as JSON.
+// Usage: CsvJsonBenchmark [points = 2000000]
+
+static constexpr int REPEATS = 3;
+
+static void WriteFiles(const std::string& csvPath, const std::string& jsonPath, std::size_t size) {
+	std::ofstream csv(csvPath, std::ofstream::binary | std::ofstream::trunc);
+	std::ofstream json(jsonPath, std::ofstream::binary | std::ofstream::trunc);
+
+	csv << "x,y\n";
+	json << "{\"data\": [";
+
+	char line[64];
+
+	for (std::size_t i = 0u; i < size; ++i) {
+		const auto x = static_cast<double>(i % 100000u) * 0.01;
+		const auto y = 3.0 * x + 2.0 + static_cast<double>(i % 7u) * 0.125;
+
+		csv.write(line, std::snprintf(line, sizeof(line), "%.4f,%.4f\n", x, y));
+		json.write(line, std::snprintf(line, sizeof(line), "%s[%.4f, %.4f]", i == 0u ? "" : ", ", x, y));
+	}
+
+	json << "], \"confidence_probability\": 0.95}\n";
+}
+
+template<class Func>
+static double GetBestSeconds(Func func) {
+	auto best = std::numeric_limits<double>::infinity();
+
+	for (auto i = 0; i < REPEATS; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+		func();
+		const auto finish = std::chrono::steady_clock::now();
+
+		best = std::min(best, std::chrono::duration<double>(finish - start).count());
+	}
+
+	return best;
+}
+
+static void PrintResult(const char* name, const std::string& path, double seconds, std::size_t size) {
+	const auto megabytes = static_cast<double>(std::filesystem::file_size(path)) / 1e6;
+
+	std::printf("%-5s %8.1f MB %8.3f s %8.1f MB/s %8.2f Mpoints/s\n",
+		name, megabytes, seconds, megabytes / seconds, static_cast<double>(size) / seconds / 1e6);
+}
+
+int main(int argc, char* argv[]) {
+	const std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000u;
+
+	const auto directory = std::filesystem::temp_directory_path();
+	const auto csvPath = (directory / "CsvJsonBenchmark.csv").string();
+	const auto jsonPath = (directory / "CsvJsonBenchmark.json").string();
+
+	WriteFiles(csvPath, jsonPath, size);
+
+	CsvOptions options;
+	options.confidenceProbability = 0.95;
+
+	const auto csvSeconds = GetBestSeconds([&] {
+		const CsvDataGetter dataGetter(csvPath, options);
+
+		if (dataGetter.GetView().GetSize() != size) {
+			throw std::runtime_error("Wrong CSV point count!");
+		}
+	});
+
+	const auto jsonSeconds = GetBestSeconds([&] {
+		const JsonDataGetter dataGetter(std::fstream(jsonPath, std::fstream::in));
+
+		if (dataGetter.GetView().GetSize() != size) {
+			throw std::runtime_error("Wrong JSON point count!");
+		}
+	});
+
+	std::printf("%zu points, best of %d\n", size, REPEATS);
+	PrintResult("CSV", csvPath, csvSeconds, size);
+	PrintResult("JSON", jsonPath, jsonSeconds, size);
+	std::printf("CSV is %.1fx faster\n", jsonSeconds / csvSeconds);
+
+	std::filesystem::remove(csvPath);
+	std::filesystem::remove(jsonPath);
+
+	return EXIT_SUCCESS;
+}
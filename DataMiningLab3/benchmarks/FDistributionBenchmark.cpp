@@ -0,0 +1,88 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "FisherF/FisherF.hpp"
+
+// Per-query latency of the F critical values: the incomplete beta inversion for arbitrary
+// degrees of freedom and levels, and the FisherF path that serves common levels from the table.
+// Usage: FDistributionBenchmark [queries = 200000]
+
+static constexpr int REPEATS = 5;
+
+struct Query {
+	int k1, k2;
+	double alpha;
+};
+
+static std::vector<Query> CreateQueries(std::size_t size, const double* alphas, std::size_t alphaCount) {
+	static constexpr std::array<int, 8> K2S = { 1, 5, 31, 118, 1000, 65536, 1000000, 1000000000 };
+
+	std::vector<Query> queries;
+	queries.reserve(size);
+
+	for (std::size_t i = 0u; i < size; ++i) {
+		queries.push_back(Query{ static_cast<int>(i % 10u) + 1, K2S[i / 10u % K2S.size()], alphas[i / 80u % alphaCount] });
+	}
+
+	return queries;
+}
+
+template<class Func>
+static double GetBestNanoseconds(const std::vector<Query>& queries, Func func) {
+	auto best = std::numeric_limits<double>::infinity();
+	auto sink = 0.0;
+
+	for (auto i = 0; i < REPEATS; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+
+		for (const auto& query : queries) {
+			sink += func(query);
+		}
+
+		const auto finish = std::chrono::steady_clock::now();
+
+		best = std::min(best, std::chrono::duration<double, std::nano>(finish - start).count());
+	}
+
+	if (!(sink > 0.0)) {
+		throw std::runtime_error("Wrong critical values!");
+	}
+
+	return best / static_cast<double>(queries.size());
+}
+
+int main(int argc, char* argv[]) {
+	const std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000u;
+
+	static constexpr std::array<double, 5> TABLE_ALPHAS = { 0.01, 0.025, 0.05, 0.10, 0.25 };
+	static constexpr std::array<double, 5> OTHER_ALPHAS = { 1e-4, 0.001, 0.02, 0.2, 0.5 };
+
+	const auto tableQueries = CreateQueries(size, TABLE_ALPHAS.data(), TABLE_ALPHAS.size());
+	const auto otherQueries = CreateQueries(size, OTHER_ALPHAS.data(), OTHER_ALPHAS.size());
+
+	const auto computed = GetBestNanoseconds(otherQueries, [](const Query& query) {
+		return FDistribution(query.k1, query.k2).GetUpperQuantile(query.alpha);
+	});
+
+	const auto reused = GetBestNanoseconds(otherQueries, [](const Query& query) {
+		static const FDistribution distribution(3, 118);
+		return distribution.GetUpperQuantile(query.alpha);
+	});
+
+	const auto table = GetBestNanoseconds(tableQueries, [](const Query& query) {
+		return FisherF(query.k1, query.k2).GetFStatistics(query.alpha);
+	});
+
+	std::printf("%zu queries, k1 = 1 .. 10, k2 = 1 .. 1e9, best of %d\n", size, REPEATS);
+	std::printf("%-40s %8.1f ns/query\n", "FDistribution, constructed per query", computed);
+	std::printf("%-40s %8.1f ns/query\n", "FDistribution(3, 118), reused", reused);
+	std::printf("%-40s %8.1f ns/query\n", "FisherF, table levels", table);
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "IDataGetter.hpp"
+#include "MappedFile.hpp"
+#include "Point/PointSet.hpp"
+
+// Layout: 64-byte header, then the x column and the y column, each aligned to 64 bytes.
+struct BinaryPointsHeader {
+	static constexpr std::array<char, 8> MAGIC = { 'D', 'M', 'L', '3', 'P', 'T', 'S', '\0' };
+	static constexpr std::uint32_t VERSION = 1u;
+
+	static constexpr std::uint32_t DTYPE_FLOAT64 = 1u;
+	static constexpr std::uint32_t DTYPE_FLOAT32 = 2u;
+
+	std::array<char, 8> magic;
+	std::uint32_t version;
+	std::uint32_t dtype;
+	std::uint64_t count;
+	double confidenceProbability;
+	std::uint64_t xOffset;
+	std::uint64_t yOffset;
+	std::array<std::uint8_t, 16> reserved;
+};
+
+static_assert(sizeof(BinaryPointsHeader) == 64u);
+
+class BinaryDataGetter : public IDataGetter {
+private:
+	static constexpr std::uint64_t ALIGNMENT = 64u;
+
+public:
+	static constexpr auto* EXTENSION_STR = ".pts";
+
+	explicit BinaryDataGetter(const std::string& path) : file_(path) {
+		this->ReadHeader();
+	}
+
+	BinaryDataGetter(const BinaryDataGetter&) = delete;
+
+	BinaryDataGetter(BinaryDataGetter&&) noexcept = default;
+
+	~BinaryDataGetter() override = default;
+
+	BinaryDataGetter& operator=(const BinaryDataGetter&) = delete;
+
+	BinaryDataGetter& operator=(BinaryDataGetter&&) noexcept = default;
+
+	[[nodiscard]] PointSetView<double> GetView() const override {
+		if (this->converted_.has_value()) {
+			return this->converted_->GetView();
+		}
+
+		return PointSetView<double>{ this->GetColumn<double>(this->header_.xOffset), this->GetColumn<double>(this->header_.yOffset) };
+	}
+
+	[[nodiscard]] double GetConfidenceProbability() const override {
+		return this->header_.confidenceProbability;
+	}
+
+	static void Write(const std::string& path, const PointSetView<double>& points, double confidenceProbability) {
+		std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("Can't create the output file!");
+		}
+
+		const auto columnSize = static_cast<std::uint64_t>(points.GetSize() * sizeof(double));
+
+		BinaryPointsHeader header{};
+		header.magic = BinaryPointsHeader::MAGIC;
+		header.version = BinaryPointsHeader::VERSION;
+		header.dtype = BinaryPointsHeader::DTYPE_FLOAT64;
+		header.count = points.GetSize();
+		header.confidenceProbability = confidenceProbability;
+		header.xOffset = BinaryDataGetter::Align(sizeof(BinaryPointsHeader));
+		header.yOffset = BinaryDataGetter::Align(header.xOffset + columnSize);
+
+		const std::vector<char> padding(BinaryDataGetter::ALIGNMENT, '\0');
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(padding.data(), static_cast<std::streamsize>(header.xOffset - sizeof(header)));
+		file.write(reinterpret_cast<const char*>(points.GetX().data()), static_cast<std::streamsize>(columnSize));
+		file.write(padding.data(), static_cast<std::streamsize>(header.yOffset - header.xOffset - columnSize));
+		file.write(reinterpret_cast<const char*>(points.GetY().data()), static_cast<std::streamsize>(columnSize));
+
+		if (!file) {
+			throw std::runtime_error("Can't write the output file!");
+		}
+	}
+
+private:
+	MappedFile file_;
+	BinaryPointsHeader header_{};
+
+	std::optional<PointSet<double>> converted_;
+
+	void ReadHeader() {
+		if (this->file_.GetSize() < sizeof(BinaryPointsHeader)) {
+			throw std::runtime_error("Binary file is too small!");
+		}
+
+		std::memcpy(&this->header_, this->file_.GetData(), sizeof(BinaryPointsHeader));
+
+		if (this->header_.magic != BinaryPointsHeader::MAGIC || this->header_.version != BinaryPointsHeader::VERSION) {
+			throw std::runtime_error("Wrong binary file format!");
+		}
+
+		std::size_t valueSize = 0u;
+
+		switch (this->header_.dtype) {
+		case BinaryPointsHeader::DTYPE_FLOAT64:
+			valueSize = sizeof(double);
+			break;
+		case BinaryPointsHeader::DTYPE_FLOAT32:
+			valueSize = sizeof(float);
+			break;
+		default:
+			throw std::runtime_error("Unsupported binary data type!");
+		}
+
+		if (this->header_.xOffset % valueSize != 0u || this->header_.yOffset % valueSize != 0u ||
+			!this->HasColumn(this->header_.xOffset, valueSize) ||
+			!this->HasColumn(this->header_.yOffset, valueSize)) {
+			throw std::runtime_error("Binary file is truncated or corrupted!");
+		}
+
+		if (this->header_.dtype == BinaryPointsHeader::DTYPE_FLOAT32) {
+			const auto x = this->GetColumn<float>(this->header_.xOffset);
+			const auto y = this->GetColumn<float>(this->header_.yOffset);
+
+			PointSet<double> converted;
+			converted.Reserve(x.size());
+
+			for (std::size_t i = 0u; i < x.size(); ++i) {
+				converted.Add(x[i], y[i]);
+			}
+
+			this->converted_ = std::move(converted);
+		}
+	}
+
+	// count values of valueSize bytes at offset lie inside the file. Checked by division, so a forged
+	// count can't wrap count * valueSize or offset + size around 2^64.
+	[[nodiscard]] bool HasColumn(std::uint64_t offset, std::uint64_t valueSize) const {
+		const std::uint64_t fileSize = this->file_.GetSize();
+
+		return offset <= fileSize && this->header_.count <= (fileSize - offset) / valueSize;
+	}
+
+	template<class T>
+	[[nodiscard]] std::span<const T> GetColumn(std::uint64_t offset) const {
+		return std::span<const T>{
+			reinterpret_cast<const T*>(this->file_.GetData() + offset), static_cast<std::size_t>(this->header_.count)
+		};
+	}
+
+	[[nodiscard]] static std::uint64_t Align(std::uint64_t offset) {
+		return (offset + BinaryDataGetter::ALIGNMENT - 1u) / BinaryDataGetter::ALIGNMENT * BinaryDataGetter::ALIGNMENT;
+	}
+};
@@ -0,0 +1,247 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "IDataGetter.hpp"
+#include "Point/PointSet.hpp"
+
+struct CsvOptions {
+	std::string xColumn = "0";
+	std::string yColumn = "1";
+	std::optional<char> delimiter;
+	std::optional<double> confidenceProbability;
+};
+
+class CsvDataGetter : public IDataGetter {
+private:
+	static constexpr std::size_t BUFFER_SIZE = 1u << 20u;
+
+public:
+	static constexpr auto* CSV_EXTENSION_STR = ".csv";
+	static constexpr auto* TSV_EXTENSION_STR = ".tsv";
+
+	explicit CsvDataGetter(const std::string& path, const CsvOptions& options) : options_(options) {
+		if (!this->options_.confidenceProbability.has_value()) {
+			throw std::runtime_error("Confidence probability must be given for CSV files!");
+		}
+
+		if (!this->options_.delimiter.has_value()) {
+			this->options_.delimiter = path.ends_with(CsvDataGetter::TSV_EXTENSION_STR) ? '\t' : ',';
+		}
+
+		this->ReadFile(path);
+	}
+
+	CsvDataGetter(const CsvDataGetter&) = delete;
+
+	CsvDataGetter(CsvDataGetter&&) noexcept = default;
+
+	~CsvDataGetter() override = default;
+
+	CsvDataGetter& operator=(const CsvDataGetter&) = delete;
+
+	CsvDataGetter& operator=(CsvDataGetter&&) noexcept = default;
+
+	[[nodiscard]] PointSetView<double> GetView() const override {
+		return this->points_.GetView();
+	}
+
+	[[nodiscard]] double GetConfidenceProbability() const override {
+		return *this->options_.confidenceProbability;
+	}
+
+private:
+	CsvOptions options_;
+	PointSet<double> points_;
+
+	std::size_t xIndex_{};
+	std::size_t yIndex_{};
+	std::size_t lineNumber_{};
+	bool isHeaderRead_{};
+
+	void ReadFile(const std::string& path) {
+		std::ifstream file(path, std::ifstream::binary);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("Wrong path or file doesn't exist!");
+		}
+
+		std::vector<char> buffer(CsvDataGetter::BUFFER_SIZE);
+		std::size_t carry = 0u;
+
+		// Views into buffer, reused by every line and valid only while the line is parsed.
+		std::vector<std::string_view> fields;
+
+		while (file) {
+			if (carry == buffer.size()) {
+				buffer.resize(buffer.size() * 2u);
+			}
+
+			file.read(buffer.data() + carry, static_cast<std::streamsize>(buffer.size() - carry));
+			const auto size = carry + static_cast<std::size_t>(file.gcount());
+
+			const std::string_view chunk{ buffer.data(), size };
+			const auto lastNewLine = chunk.rfind('\n');
+
+			if (lastNewLine == std::string_view::npos) {
+				carry = size;
+				continue;
+			}
+
+			this->ParseLines(chunk.substr(0u, lastNewLine + 1u), fields);
+
+			carry = size - lastNewLine - 1u;
+			std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(lastNewLine + 1u),
+				buffer.begin() + static_cast<std::ptrdiff_t>(size), buffer.begin());
+		}
+
+		if (carry != 0u) {
+			this->ParseLine(std::string_view{ buffer.data(), carry }, fields);
+		}
+	}
+
+	void ParseLines(std::string_view lines, std::vector<std::string_view>& fields) {
+		while (!lines.empty()) {
+			const auto end = lines.find('\n');
+
+			this->ParseLine(lines.substr(0u, end), fields);
+			lines.remove_prefix(end + 1u);
+		}
+	}
+
+	void ParseLine(std::string_view line, std::vector<std::string_view>& fields) {
+		++this->lineNumber_;
+
+		if (!line.empty() && line.back() == '\r') {
+			line.remove_suffix(1u);
+		}
+
+		if (CsvDataGetter::Trim(line).empty()) {
+			return;
+		}
+
+		this->SplitFields(line, fields);
+
+		if (!this->isHeaderRead_) {
+			this->isHeaderRead_ = true;
+
+			if (this->ReadHeader(fields)) {
+				return;
+			}
+		}
+
+		if (fields.size() <= std::max(this->xIndex_, this->yIndex_)) {
+			throw std::runtime_error("Too few columns in CSV line " + std::to_string(this->lineNumber_) + "!");
+		}
+
+		const auto x = CsvDataGetter::ParseNumber(fields[this->xIndex_]);
+		const auto y = CsvDataGetter::ParseNumber(fields[this->yIndex_]);
+
+		if (!x.has_value() || !y.has_value()) {
+			throw std::runtime_error("Wrong number in CSV line " + std::to_string(this->lineNumber_) + "!");
+		}
+
+		this->points_.Add(*x, *y);
+	}
+
+	// Resolves the column names and returns true if the first non-empty line is a header.
+	bool ReadHeader(const std::vector<std::string_view>& fields) {
+		const auto xIndex = CsvDataGetter::ParseIndex(this->options_.xColumn);
+		const auto yIndex = CsvDataGetter::ParseIndex(this->options_.yColumn);
+
+		this->xIndex_ = xIndex.has_value() ? *xIndex : CsvDataGetter::FindColumn(fields, this->options_.xColumn);
+		this->yIndex_ = yIndex.has_value() ? *yIndex : CsvDataGetter::FindColumn(fields, this->options_.yColumn);
+
+		if (!xIndex.has_value() || !yIndex.has_value()) {
+			return true;
+		}
+
+		const auto isNumber = [&fields](std::size_t index) {
+			return index < fields.size() && CsvDataGetter::ParseNumber(fields[index]).has_value();
+		};
+
+		return !isNumber(this->xIndex_) || !isNumber(this->yIndex_);
+	}
+
+	[[nodiscard]] static std::size_t FindColumn(const std::vector<std::string_view>& fields, const std::string& name) {
+		const auto iter = std::find_if(fields.cbegin(), fields.cend(), [&name](std::string_view field) {
+			return CsvDataGetter::Unquote(field) == name;
+		});
+
+		if (iter == fields.cend()) {
+			throw std::runtime_error("Column \"" + name + "\" is not found in the CSV header!");
+		}
+
+		return static_cast<std::size_t>(std::distance(fields.cbegin(), iter));
+	}
+
+	void SplitFields(std::string_view line, std::vector<std::string_view>& fields) const {
+		fields.clear();
+
+		while (true) {
+			const auto end = line.find(*this->options_.delimiter);
+			fields.push_back(line.substr(0u, end));
+
+			if (end == std::string_view::npos) {
+				break;
+			}
+
+			line.remove_prefix(end + 1u);
+		}
+	}
+
+	[[nodiscard]] static std::optional<double> ParseNumber(std::string_view field) {
+		field = CsvDataGetter::Unquote(field);
+
+		if (!field.empty() && field.front() == '+') {
+			field.remove_prefix(1u);
+		}
+
+		double value{};
+		const auto [end, error] = std::from_chars(field.data(), field.data() + field.size(), value);
+
+		if (error != std::errc{} || end != field.data() + field.size() || field.empty()) {
+			return std::nullopt;
+		}
+
+		return value;
+	}
+
+	[[nodiscard]] static std::optional<std::size_t> ParseIndex(std::string_view column) {
+		std::size_t value{};
+		const auto [end, error] = std::from_chars(column.data(), column.data() + column.size(), value);
+
+		if (error != std::errc{} || end != column.data() + column.size() || column.empty()) {
+			return std::nullopt;
+		}
+
+		return value;
+	}
+
+	[[nodiscard]] static std::string_view Unquote(std::string_view field) {
+		field = CsvDataGetter::Trim(field);
+
+		if (field.size() >= 2u && field.front() == '"' && field.back() == '"') {
+			field = field.substr(1u, field.size() - 2u);
+		}
+
+		return field;
+	}
+
+	[[nodiscard]] static std::string_view Trim(std::string_view field) {
+		const auto begin = field.find_first_not_of(" \t");
+
+		if (begin == std::string_view::npos) {
+			return {};
+		}
+
+		return field.substr(begin, field.find_last_not_of(" \t") - begin + 1u);
+	}
+};
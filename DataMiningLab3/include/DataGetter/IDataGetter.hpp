@@ -1,12 +1,27 @@
 #pragma once
-#include <vector>
+#include <cstddef>
 
-#include "Point/Point.hpp"
+#include "Point/DesignMatrix.hpp"
+#include "Point/PointSet.hpp"
 
 struct IDataGetter {
 	virtual ~IDataGetter() = default;
 
-	[[nodiscard]] virtual std::vector<Point<double>> GetData() const = 0;
+	// Borrowed view of the columns, valid while the getter is alive.
+	[[nodiscard]] virtual PointSetView<double> GetView() const = 0;
 
 	[[nodiscard]] virtual double GetConfidenceProbability() const = 0;
+
+	// All regressors of the source, a single-column matrix over GetView() unless overridden.
+	[[nodiscard]] virtual DesignMatrixView<double> GetDesignView() const {
+		return DesignMatrixView<double>{ this->GetView() };
+	}
+
+	[[nodiscard]] virtual PointSet<double> GetData() const {
+		return PointSet<double>{ this->GetView() };
+	}
+
+	[[nodiscard]] PointSetChunks<double> GetChunks(std::size_t chunkSize) const {
+		return this->GetView().GetChunks(chunkSize);
+	}
 };
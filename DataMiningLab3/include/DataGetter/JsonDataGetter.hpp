@@ -1,58 +1,74 @@
 #pragma once
 #include <fstream>
-#include <vector>
+#include <istream>
+#include <span>
+#include <stdexcept>
 
 #include "nlohmann/json.hpp"
 
 #include "IDataGetter.hpp"
-#include "Point/Point.hpp"
+#include "JsonPointsHandler.hpp"
+#include "Point/DesignMatrix.hpp"
+#include "Point/PointSet.hpp"
 
 class JsonDataGetter : public IDataGetter {
-private:
-	static constexpr auto* DATA_STR = "data";
-	static constexpr auto* PROBABILITY_STR = "confidence_probability";
-
 public:
-	explicit JsonDataGetter(std::fstream file) : file_(file) {
-		this->ReadFile();
+	explicit JsonDataGetter(std::fstream file) {
+		this->ReadFile(file);
 	}
-	;
+
 	JsonDataGetter(const JsonDataGetter&) = delete;
 
 	JsonDataGetter(JsonDataGetter&&) noexcept = default;
 
 	~JsonDataGetter() override = default;
 
-	JsonDataGetter& operator=(const JsonDataGetter&) = default;
+	JsonDataGetter& operator=(const JsonDataGetter&) = delete;
 
 	JsonDataGetter& operator=(JsonDataGetter&&) noexcept = default;
 
-	[[nodiscard]] std::vector<Point<double>> GetData() const override {
-		const auto pairs
-			= this->json_[JsonDataGetter::DATA_STR].get<std::vector<std::pair<double, double>>>();
-
-		std::vector<Point<double>> result(pairs.size());
-
-		std::ranges::for_each(pairs,
-			[iter = result.begin()](const auto& pair) mutable  {
-			*iter++ = Point<double>{ pair };
-		}
-		);
+	[[nodiscard]] PointSetView<double> GetView() const override {
+		return this->data_.GetView().GetPoints();
+	}
 
-		return result;
+	[[nodiscard]] DesignMatrixView<double> GetDesignView() const override {
+		return this->data_.GetView();
 	}
 
 	[[nodiscard]] double GetConfidenceProbability() const override {
-		return this->json_[JsonDataGetter::PROBABILITY_STR].get<double>();
+		return this->probability_;
+	}
+
+	// Streams every [x1, ..., xk, y] row of the input into sink(row) without
+	// keeping the points, and returns the confidence probability.
+	template<class Sink>
+	static double ReadPoints(std::istream& input, Sink sink) {
+		JsonPointsHandler<Sink> handler{ std::move(sink) };
+
+		nlohmann::json::sax_parse(input, &handler);
+
+		const auto probability = handler.GetConfidenceProbability();
+
+		if (!probability.has_value()) {
+			throw std::runtime_error("Confidence probability is missing!");
+		}
+
+		return *probability;
 	}
 
 private:
-	std::reference_wrapper<std::fstream> file_;
-	nlohmann::json json_{};
+	DesignMatrix<double> data_{ 1u };
+	double probability_{};
+
+	void ReadFile(std::fstream& file) {
+		if (file.is_open()) {
+			this->probability_ = JsonDataGetter::ReadPoints(file, [this](std::span<const double> row) {
+				if (this->data_.GetRowCount() == 0u && this->data_.GetColumnCount() != row.size() - 1u) {
+					this->data_ = DesignMatrix<double>{ row.size() - 1u };
+				}
 
-	void ReadFile() {
-		if (this->file_.get().is_open()) {
-			this->file_ >> this->json_;
+				this->data_.Add(row.first(row.size() - 1u), row.back());
+			});
 		}
 	}
 };
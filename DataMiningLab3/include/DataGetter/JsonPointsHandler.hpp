@@ -0,0 +1,153 @@
+#pragma once
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+// SAX handler for the {"data": [[x1, ..., xk, y], ...], "confidence_probability": p} layout.
+// Every row is handed to the sink as a span as soon as it is closed, no DOM is built.
+template<class Sink>
+class JsonPointsHandler {
+private:
+	enum class Section {
+		None,
+		Data,
+		Probability
+	};
+
+	static constexpr auto* DATA_STR = "data";
+	static constexpr auto* PROBABILITY_STR = "confidence_probability";
+
+	static constexpr int ROW_DEPTH = 3;
+	static constexpr std::size_t MIN_ROW_SIZE = 2u;
+
+public:
+	explicit JsonPointsHandler(Sink sink) : sink_(std::move(sink)) {
+
+	}
+
+	[[nodiscard]] std::optional<double> GetConfidenceProbability() const {
+		return this->probability_;
+	}
+
+	//-------------------- SAX EVENTS -------------------------------------//
+
+	bool null() {
+		return this->Unexpected();
+	}
+
+	bool boolean(bool) {
+		return this->Unexpected();
+	}
+
+	bool number_integer(nlohmann::json::number_integer_t value) {
+		return this->Number(static_cast<double>(value));
+	}
+
+	bool number_unsigned(nlohmann::json::number_unsigned_t value) {
+		return this->Number(static_cast<double>(value));
+	}
+
+	bool number_float(nlohmann::json::number_float_t value, const nlohmann::json::string_t&) {
+		return this->Number(value);
+	}
+
+	bool string(nlohmann::json::string_t&) {
+		return this->Unexpected();
+	}
+
+	bool binary(nlohmann::json::binary_t&) {
+		return this->Unexpected();
+	}
+
+	bool start_object(std::size_t) {
+		++this->depth_;
+		return true;
+	}
+
+	bool key(nlohmann::json::string_t& key) {
+		if (this->depth_ == 1) {
+			this->section_ = key == JsonPointsHandler::DATA_STR
+				? Section::Data
+				: key == JsonPointsHandler::PROBABILITY_STR ? Section::Probability : Section::None;
+		}
+
+		return true;
+	}
+
+	bool end_object() {
+		--this->depth_;
+		return true;
+	}
+
+	bool start_array(std::size_t) {
+		++this->depth_;
+
+		if (this->section_ == Section::Data && this->depth_ == JsonPointsHandler::ROW_DEPTH) {
+			this->row_.clear();
+		}
+
+		return true;
+	}
+
+	bool end_array() {
+		if (this->section_ == Section::Data && this->depth_ == JsonPointsHandler::ROW_DEPTH) {
+			if (this->row_.size() < JsonPointsHandler::MIN_ROW_SIZE) {
+				throw std::runtime_error("Every data row must contain at least two numbers!");
+			}
+
+			if (this->rowSize_ == 0u) {
+				this->rowSize_ = this->row_.size();
+			}
+			else if (this->row_.size() != this->rowSize_) {
+				throw std::runtime_error("Every data row must contain the same number of values!");
+			}
+
+			this->sink_(std::span<const double>{ this->row_ });
+		}
+
+		--this->depth_;
+		return true;
+	}
+
+	bool parse_error(std::size_t, const std::string&, const nlohmann::json::exception& exception) {
+		throw std::runtime_error(exception.what());
+	}
+
+private:
+	Sink sink_;
+
+	int depth_{};
+	Section section_{ Section::None };
+
+	std::vector<double> row_;
+	std::size_t rowSize_{};
+
+	std::optional<double> probability_;
+
+	bool Number(double value) {
+		if (this->section_ == Section::Data && this->depth_ == JsonPointsHandler::ROW_DEPTH) {
+			this->row_.push_back(value);
+		}
+		else if (this->section_ == Section::Data && this->depth_ > 1) {
+			return this->Unexpected();
+		}
+		else if (this->section_ == Section::Probability && this->depth_ == 1) {
+			this->probability_ = value;
+		}
+
+		return true;
+	}
+
+	bool Unexpected() const {
+		if (this->section_ == Section::Data && this->depth_ > 1) {
+			throw std::runtime_error("Data rows must contain only numbers!");
+		}
+
+		return true;
+	}
+};
@@ -0,0 +1,166 @@
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if defined(_WIN32)
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <Windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+// Read-only memory mapping of a whole file.
+class MappedFile final {
+public:
+	explicit MappedFile(const std::string& path) {
+		this->Map(path);
+	}
+
+	MappedFile(const MappedFile&) = delete;
+
+	MappedFile(MappedFile&& other) noexcept {
+		this->Swap(other);
+	}
+
+	~MappedFile() noexcept {
+		this->Unmap();
+	}
+
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	MappedFile& operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			this->Unmap();
+			this->Swap(other);
+		}
+
+		return *this;
+	}
+
+	[[nodiscard]] const std::byte* GetData() const {
+		return static_cast<const std::byte*>(this->data_);
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->size_;
+	}
+
+private:
+	void* data_{};
+	std::size_t size_{};
+
+#if defined(_WIN32)
+	HANDLE file_{ INVALID_HANDLE_VALUE };
+	HANDLE mapping_{};
+
+	void Map(const std::string& path) {
+		this->file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+			OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (this->file_ == INVALID_HANDLE_VALUE) {
+			throw std::runtime_error("Wrong path or file doesn't exist!");
+		}
+
+		LARGE_INTEGER size{};
+
+		if (!GetFileSizeEx(this->file_, &size)) {
+			this->Unmap();
+			throw std::runtime_error("Can't get the size of the file!");
+		}
+
+		this->size_ = static_cast<std::size_t>(size.QuadPart);
+
+		if (this->size_ == 0u) {
+			return;
+		}
+
+		this->mapping_ = CreateFileMappingA(this->file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		this->data_ = this->mapping_ ? MapViewOfFile(this->mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+		if (this->data_ == nullptr) {
+			this->Unmap();
+			throw std::runtime_error("Can't map the file into memory!");
+		}
+	}
+
+	void Unmap() noexcept {
+		if (this->data_ != nullptr) {
+			UnmapViewOfFile(this->data_);
+		}
+
+		if (this->mapping_ != nullptr) {
+			CloseHandle(this->mapping_);
+		}
+
+		if (this->file_ != INVALID_HANDLE_VALUE) {
+			CloseHandle(this->file_);
+		}
+
+		this->data_ = nullptr;
+		this->size_ = 0u;
+		this->mapping_ = nullptr;
+		this->file_ = INVALID_HANDLE_VALUE;
+	}
+
+	void Swap(MappedFile& other) noexcept {
+		std::swap(this->data_, other.data_);
+		std::swap(this->size_, other.size_);
+		std::swap(this->file_, other.file_);
+		std::swap(this->mapping_, other.mapping_);
+	}
+#else
+	void Map(const std::string& path) {
+		const auto descriptor = open(path.c_str(), O_RDONLY);
+
+		if (descriptor < 0) {
+			throw std::runtime_error("Wrong path or file doesn't exist!");
+		}
+
+		struct stat status{};
+
+		if (fstat(descriptor, &status) != 0) {
+			close(descriptor);
+			throw std::runtime_error("Can't get the size of the file!");
+		}
+
+		this->size_ = static_cast<std::size_t>(status.st_size);
+
+		if (this->size_ != 0u) {
+			this->data_ = mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+			if (this->data_ == MAP_FAILED) {
+				this->data_ = nullptr;
+				this->size_ = 0u;
+				close(descriptor);
+				throw std::runtime_error("Can't map the file into memory!");
+			}
+
+			madvise(this->data_, this->size_, MADV_SEQUENTIAL);
+		}
+
+		close(descriptor);
+	}
+
+	void Unmap() noexcept {
+		if (this->data_ != nullptr) {
+			munmap(this->data_, this->size_);
+		}
+
+		this->data_ = nullptr;
+		this->size_ = 0u;
+	}
+
+	void Swap(MappedFile& other) noexcept {
+		std::swap(this->data_, other.data_);
+		std::swap(this->size_, other.size_);
+	}
+#endif
+};
@@ -5,12 +5,12 @@
 
 class TestDataGetter : public IDataGetter {
 private:
-	static const std::unique_ptr<std::vector<Point<double>>> DATA;
+	static const std::unique_ptr<PointSet<double>> DATA;
 	static constexpr double CONFIDENCE_PROBABILITY = 0.95;
 
 public:
-	[[nodiscard]] std::vector<Point<double>> GetData() const override {
-		return *TestDataGetter::DATA;
+	[[nodiscard]] PointSetView<double> GetView() const override {
+		return TestDataGetter::DATA->GetView();
 	}
 
 	[[nodiscard]] double GetConfidenceProbability() const override {
@@ -18,9 +18,9 @@ public:
 	}
 };
 
-const std::unique_ptr<std::vector<Point<double>>> TestDataGetter::DATA
-	= std::make_unique<std::vector<Point<double>>>(
-		std::vector{
+const std::unique_ptr<PointSet<double>> TestDataGetter::DATA
+	= std::make_unique<PointSet<double>>(
+		std::initializer_list{
 			Point<double>(1.0, 0.0),
 			Point<double>(-1.0, -2.0),
 			Point<double>(1.0, 1.0),
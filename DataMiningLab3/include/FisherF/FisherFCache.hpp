@@ -0,0 +1,100 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "FisherFTable.hpp"
+
+// Constant-time lookups into FisherFTable indexed by (alpha bucket, k1, k2).
+// k2 up to MAX_DENSE_K2 is read directly, larger k2 are interpolated with a cubic in t = MAX_DENSE_K2 / k2,
+// which is how F approaches its k2 = infinity limit.
+class FisherFCache final {
+private:
+	static constexpr double ALPHA_EPSILON = 1e-9;
+
+public:
+	FisherFCache() = delete;
+
+	// Critical value for P(F > x) = alpha, or nothing if (alpha, k1) is off the grid.
+	[[nodiscard]] static constexpr std::optional<double> Find(double alpha, int k1, std::int64_t k2) {
+		const auto bucket = FisherFCache::FindBucket(alpha);
+
+		if (!bucket.has_value() || k1 < 1 || k1 > FisherFTable::MAX_K1 || k2 < 1) {
+			return std::nullopt;
+		}
+
+		const auto row = FisherFCache::GetRowOffset(*bucket, k1);
+
+		if (k2 <= FisherFTable::MAX_DENSE_K2) {
+			return FisherFTable::VALUES[row + static_cast<std::size_t>(k2 - 1)];
+		}
+
+		// Four-point Lagrange stencil over tail nodes first .. first + 3.
+		const auto position = static_cast<double>(FisherFTable::MAX_DENSE_K2) / static_cast<double>(k2) * FisherFTable::TAIL_NODES;
+		const auto first = std::clamp(static_cast<int>(position) - 1, 0, FisherFTable::TAIL_NODES - 3);
+		const auto u = position - first;
+
+		const auto y0 = FisherFCache::GetTail(row, first);
+		const auto y1 = FisherFCache::GetTail(row, first + 1);
+		const auto y2 = FisherFCache::GetTail(row, first + 2);
+		const auto y3 = FisherFCache::GetTail(row, first + 3);
+
+		return -y0 * (u - 1.0) * (u - 2.0) * (u - 3.0) / 6.0
+			+ y1 * u * (u - 2.0) * (u - 3.0) / 2.0
+			- y2 * u * (u - 1.0) * (u - 3.0) / 2.0
+			+ y3 * u * (u - 1.0) * (u - 2.0) / 6.0;
+	}
+
+private:
+	[[nodiscard]] static constexpr std::optional<std::size_t> FindBucket(double alpha) {
+		for (std::size_t i = 0u; i < FisherFTable::ALPHAS.size(); ++i) {
+			const auto difference = alpha - FisherFTable::ALPHAS[i];
+
+			if (difference <= FisherFCache::ALPHA_EPSILON && difference >= -FisherFCache::ALPHA_EPSILON) {
+				return i;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	[[nodiscard]] static constexpr std::size_t GetRowOffset(std::size_t bucket, int k1) {
+		return (bucket * FisherFTable::MAX_K1 + static_cast<std::size_t>(k1 - 1)) * FisherFTable::ROW_SIZE;
+	}
+
+	// Tail node TAIL_NODES coincides with the last dense entry, k2 = MAX_DENSE_K2.
+	[[nodiscard]] static constexpr double GetTail(std::size_t row, int i) {
+		return i == FisherFTable::TAIL_NODES
+			? FisherFTable::VALUES[row + FisherFTable::MAX_DENSE_K2 - 1u]
+			: FisherFTable::VALUES[row + FisherFTable::MAX_DENSE_K2 + static_cast<std::size_t>(i)];
+	}
+};
+
+//---- SELF-CHECK ----//
+
+namespace FisherFCacheCheck {
+	[[nodiscard]] constexpr bool IsNear(std::optional<double> value, double expected, double tolerance) {
+		return value.has_value() && *value - expected <= tolerance * expected && expected - *value <= tolerance * expected;
+	}
+
+	// Printed tables.
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.05, 1, 7), 5.59, 1e-3));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.05, 1, 1), 161.4, 1e-3));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.10, 1, 30), 2.88, 1e-3));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.01, 3, 20), 4.94, 1e-3));
+
+	// Closed forms: F(1, 1) = tan^2(pi (1 - alpha) / 2), F(2, k2) = k2 / 2 (alpha^(-2 / k2) - 1).
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.25, 1, 1), 5.828427124746190, 1e-10));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.10, 2, 10), 2.924465962305567, 1e-10));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.05, 2, 120), 3.071779404658685, 1e-10));
+
+	// Interpolated tail against the chi-square limit, F(alpha; k1, infinity) = chi2(alpha; k1) / k1.
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.05, 1, 1'000'000'000), 3.841458820694124, 1e-8));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.01, 2, 1'000'000'000), 4.605170185988091, 1e-8));
+	static_assert(FisherFCacheCheck::IsNear(FisherFCache::Find(0.05, 1, 5'000'000'000), 3.841458820694124, 1e-8));
+
+	// Off-grid queries are left to FDistribution.
+	static_assert(!FisherFCache::Find(0.2, 1, 10).has_value());
+	static_assert(!FisherFCache::Find(0.05, 11, 10).has_value());
+}
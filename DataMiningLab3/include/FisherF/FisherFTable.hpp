@@ -0,0 +1,974 @@
+#pragma once
+#include <array>
+#include <cstddef>
+
+// Upper critical values F(alpha; k1, k2), P(F > x) = alpha, printed by tools/FisherFTableGenerator
+// from FDistribution::GetUpperQuantile.
+//
+// One row of ROW_SIZE values per (alpha, k1), rows ordered by alpha, then by k1:
+//   [0, MAX_DENSE_K2)                     k2 = 1 .. MAX_DENSE_K2;
+//   [MAX_DENSE_K2, MAX_DENSE_K2 + TAIL)   node i at t = MAX_DENSE_K2 / k2 = i / TAIL_NODES,
+//                                         node 0 (k2 = infinity) is 2 F(k1, 2e6) - F(k1, 1e6).
+// Regenerate the file if any of the constants below or FDistribution changes, the FisherFTableIsCurrent test
+// fails until then.
+struct FisherFTable {
+	static constexpr std::array<double, 5> ALPHAS = { 0.01, 0.025, 0.05, 0.1, 0.25 };
+
+	static constexpr int MAX_K1 = 10;
+	static constexpr int MAX_DENSE_K2 = 120;
+	static constexpr int TAIL_NODES = 16;
+
+	static constexpr std::size_t ROW_SIZE = FisherFTable::MAX_DENSE_K2 + FisherFTable::TAIL_NODES;
+
+	static constexpr std::array<double, FisherFTable::ALPHAS.size() * FisherFTable::MAX_K1 * FisherFTable::ROW_SIZE> VALUES = {
+		// alpha = 0.01, k1 = 1
+		4052.18069547683, 98.502512562814, 34.1162215645298, 21.1976895843913, 16.2581770398337, 13.7450225333042, 12.2463833484351, 11.2586241432726,
+		10.5614310473954, 10.0442892733966, 9.64603411196625, 9.33021210316856, 9.07380572851567, 8.86159266517643, 8.68311681763895, 8.5309652858962,
+		8.39974014518964, 8.28541955509966, 8.18494682246893, 8.09595806408569, 8.01659694680849, 7.94538572917003, 7.88113364136837, 7.82287059336798,
+		7.76979841536899, 7.72125445773759, 7.67668404888748, 7.63561939776282, 7.59766324995402, 7.56247609463863, 7.52976605484418, 7.49928082732367,
+		7.47080120362067, 7.44413582226323, 7.41911688780124, 7.3955966552538, 7.37344452506974, 7.35254462849262, 7.33279380946876, 7.31409992920511,
+		7.29638043480217, 7.27956114522365, 7.26357521708004, 7.248362259923, 7.23386757644451, 7.22004150749172, 7.20683886541871, 7.19421844218795,
+		7.18214258097163, 7.17057680189608, 7.15948947411409, 7.14885152765394, 7.13863619952984, 7.1288188094555, 7.11937656121333, 7.11028836632021,
+		7.10153468712458, 7.09309739688391, 7.08495965471618, 7.07710579361412, 7.06952121995842, 7.06219232317484, 7.05510639436276, 7.04825155287047,
+		7.04161667992904, 7.0351913585643, 7.02896581910536, 7.02293088969157, 7.01707795125033, 7.01139889648275, 7.00588609244555, 7.00053234636888,
+		6.99533087438635, 6.99027527289291, 6.98535949227638, 6.9805778127964, 6.97592482240836, 6.97139539635286, 6.96698467834699, 6.96268806323521,
+		6.95850118096734, 6.95441988178717, 6.95044022252786, 6.94655845391598, 6.9427710088016, 6.9390744912349, 6.93546566631894, 6.9319414507764,
+		6.92849890417088, 6.9251352207318, 6.92184772173319, 6.91863384838527, 6.91549115519752, 6.91241730377711, 6.90941005703097, 6.90646727373988,
+		6.90358690347815, 6.90076698185183, 6.89800562603442, 6.89530103057807, 6.89265146347799, 6.89005526247793, 6.88751083159333, 6.88501663784232,
+		6.88257120816777, 6.88017312653753, 6.87782103121219, 6.87551361216787, 6.87324960866452, 6.87102780695037, 6.86884703809372, 6.86670617593178,
+		6.86460413513497, 6.8625398693707, 6.86051236956938, 6.8585206622797, 6.85656380811071, 6.85464090025598, 6.85275106309257, 6.85089345085263,
+		6.63489660098637, 6.64810738757374, 6.66135610821171, 6.67464289030368, 6.68796786168008, 6.701331150635, 6.71473288592793, 6.72817319678554,
+		6.74165221290342, 6.75517006444789, 6.76872688205774, 6.78232279684619, 6.79595794040244, 6.80963244479322, 6.82334644256578, 6.83710006674838,
+
+		// alpha = 0.01, k1 = 2
+		4999.5, 99, 30.8165203504783, 18, 13.2739336120048, 10.9247665008383, 9.54657802110229, 8.64911064067352,
+		8.02151730993206, 7.5594321575479, 7.20571335045738, 6.9266081401913, 6.70096453588078, 6.51488410218275, 6.35887348066718, 6.22623528031139,
+		6.11211371579788, 6.01290483480053, 5.92587902229285, 5.84893192461114, 5.78041568824256, 5.71902191248227, 5.66369876809605, 5.61359121146484,
+		5.56799713432409, 5.52633471393897, 5.4881177684207, 5.45293692122393, 5.42044504030731, 5.39034586317789, 5.36238502440815, 5.33634291461319,
+		5.31202894968949, 5.28927693616659, 5.26794129593954, 5.24789397026791, 5.22902186476912, 5.21122472835954, 5.19441338261437, 5.17850823588334,
+		5.16343803018184, 5.1491387794357, 5.1355528658662, 5.12262826772545, 5.11031789665179, 5.09857902692622, 5.08737280210749, 5.07666380708611,
+		5.06641969566355, 5.05661086543534, 5.04721017311829, 5.03819268457534, 5.02953545470503, 5.02121733311707, 5.01321879213944, 5.00552177422046,
+		4.99810955622313, 4.99096662847093, 4.98407858670804, 4.97743203539496, 4.97101450097577, 4.96481435393911, 4.95882073864981, 4.95302351006266,
+		4.94741317654419, 4.94198084812531, 4.93671818959301, 4.93161737790155, 4.92667106344609, 4.92187233479624, 4.91721468653457, 4.91269198988609,
+		4.90829846585953, 4.90402866065404, 4.89987742311146, 4.89583988401816, 4.89191143708228, 4.88808772142986, 4.88436460548065, 4.88073817207855,
+		4.87720470476336, 4.8737606750843, 4.87040273086313, 4.86712768532543, 4.8639325070264, 4.86081431050346, 4.85777034759583, 4.85479799937607,
+		4.85189476864391, 4.84905827293692, 4.84628623801721, 4.84357649179697, 4.84092695866817, 4.83833565420584, 4.83580068021655, 4.83332022010603,
+		4.83089253454198, 4.82851595739034, 4.82618889190626, 4.82390980715926, 4.82167723467773, 4.81948976529675, 4.81734604619421, 4.81524477810366,
+		4.81318471269044, 4.81116465008061, 4.8091834365326, 4.80723996224145, 4.80533315926743, 4.8034619995811, 4.8016254932159, 4.79982268652342,
+		4.79805266052343, 4.79631452934252, 4.79460743873738, 4.79293056469521, 4.79128311210868, 4.78966431351982, 4.78807342792868, 4.78650973966263,
+		4.60517018595553, 4.61623349039404, 4.62733224645541, 4.63846658199555, 4.64963662532946, 4.66084250526571, 4.67208435110851, 4.68336229265959,
+		4.6946764602203, 4.70602698459353, 4.71741399708575, 4.72883762950913, 4.74029801418323, 4.7517952839374, 4.76332957211278, 4.77490101256433,
+
+		// alpha = 0.01, k1 = 3
+		5403.35201373855, 99.1662013744716, 29.4566951267546, 16.6943692371751, 12.059953691652, 9.77953824092328, 8.45128505307999, 7.59099194759885,
+		6.99191722223347, 6.55231255751521, 6.21672981153865, 5.95254468154587, 5.73938028277338, 5.56388583969374, 5.41696485781842, 5.29221404552095,
+		5.18499991729522, 5.09188952041401, 5.01028684361961, 4.93819338231053, 4.8740461970007, 4.81660577781606, 4.76487675937442, 4.7180508074958,
+		4.67546478232591, 4.63656962433435, 4.60090689466229, 4.56809086367958, 4.53779467776113, 4.50973956245906, 4.48368631323742, 4.45942852850326,
+		4.43678718310521, 4.41560624286328, 4.3957490946751, 4.37709562080117, 4.35953978584891, 4.34298763473997, 4.32735562234721, 4.31256921249214,
+		4.29856169700872, 4.28527319561584, 4.27264980513852, 4.26064287271542, 4.24920837243261, 4.23830636862545, 4.22790055212189, 4.21795783812723,
+		4.2084480164067, 4.1993434460055, 4.190618788033, 4.1822507710912, 4.17421798479083, 4.16650069751096, 4.15908069514719, 4.15194113808325,
+		4.14506643402929, 4.13844212471186, 4.1320547846878, 4.12589193079565, 4.1199419409638, 4.11419398126617, 4.10863794026571, 4.10326436980982,
+		4.0980644315509, 4.0930298485563, 4.08815286145192, 4.08342618861182, 4.07884298996471, 4.07439683404052, 4.07008166792315, 4.06589178981538,
+		4.06182182395439, 4.0578666976467, 4.05402162021641, 4.05028206368357, 4.04664374500876, 4.04310260975819, 4.03965481705826, 4.03629672572249,
+		4.03302488144573, 4.02983600497078, 4.02672698114293, 4.02369484877511, 4.02073679125487, 4.01785012783048, 4.01503230551939, 4.0122808915884,
+		4.00959356655814, 4.00696811769048, 4.00440243291989, 4.00189449519422, 3.99944237719277, 3.99704423639267, 3.99469831045751, 3.99240291292313,
+		3.9901564291591, 3.98795731258555, 3.98580408112608, 3.9836953138809, 3.98162964800278, 3.97960577576348, 3.97762244179541, 3.97567844049778,
+		3.97377261359521, 3.97190384783854, 3.97007107283854, 3.9682732590233, 3.96650941571165, 3.96477858929397, 3.96307986151514, 3.96141234785084,
+		3.95977519597384, 3.95816758430194, 3.9565887206246, 3.95503784080218, 3.95351420753376, 3.95201710918957, 3.95054585870306, 3.94909979252083,
+		3.78162224334986, 3.79182700420035, 3.80206617437535, 3.81233988127592, 3.82264825277558, 3.83299141725391, 3.84336950359864, 3.85378264120773,
+		3.86423095999149, 3.87471459037461, 3.88523366329835, 3.8957883102226, 3.90637866312801, 3.91700485451807, 3.92766701742146, 3.93836528539403,
+
+		// alpha = 0.01, k1 = 4
+		5624.58332962944, 99.249371855331, 28.7098983872982, 15.9770248525577, 11.3919280713498, 9.14830103022785, 7.8466450625466, 7.00607662295559,
+		6.4220854581532, 5.99433866162936, 5.66830021287877, 5.41195143447314, 5.20533018941624, 5.03537797332944, 4.89320958932158, 4.77257799972322,
+		4.66896760195141, 4.57903596659845, 4.5002576989067, 4.43069016143777, 4.3688151740782, 4.31342949695958, 4.2635674594575, 4.21844526735626,
+		4.17742023464564, 4.13996048369501, 4.10562211308335, 4.07403177491961, 4.04487322608457, 4.01787683658753, 3.99281132460597, 3.96947718662844,
+		3.94770143115757, 3.92733332434261, 3.90824092806367, 3.89030826368678, 3.8734329736027, 3.85752438165343, 3.84250187535872, 3.82829354940488,
+		3.81483506251824, 3.80206866960716, 3.78994239863559, 3.77840934761859, 3.76742708179451, 3.75695711472179, 3.74696445999169, 3.73741724260353,
+		3.72828636094823, 3.71954519188081, 3.7111693326123, 3.70313637417182, 3.69542570202745, 3.68801832014404, 3.68089669532854, 3.67404461918645,
+		3.66744708540958, 3.66109018044618, 3.65496098588187, 3.64904749109499, 3.64333851494684, 3.63782363543582, 3.63249312638703, 3.62733790036977,
+		3.62234945714088, 3.61751983699942, 3.61284157851611, 3.60830768016614, 3.60391156545162, 3.59964705114904, 3.5955083183599, 3.59148988608035,
+		3.58758658703772, 3.58379354557031, 3.58010615735215, 3.57652007078514, 3.57303116990145, 3.56963555863473, 3.56632954633396, 3.5631096344075,
+		3.55997250399502, 3.5569150045768, 3.55393414343831, 3.55102707591558, 3.5481910963554, 3.54542362972941, 3.54272222384796, 3.54008454212407,
+		3.53750835684278, 3.53499154289532, 3.53253207194065, 3.53012800696141, 3.52777749718293, 3.52547877332781, 3.52323014318028, 3.5210299874369,
+		3.5188767558229, 3.51676896345329, 3.51470518742256, 3.51268406360501, 3.51070428365115, 3.50876459216699, 3.50686378406193, 3.5050007020551,
+		3.5031742343282, 3.5013833123152, 3.49962690861996, 3.49790403505295, 3.49621374077875, 3.4945551105685, 3.4929272631486, 3.49132934964089,
+		3.48976055208832, 3.48822008205944, 3.48670717932887, 3.48522111062717, 3.48376116845692, 3.48232666997043, 3.48091695590589, 3.47953138957779,
+		3.31917603396586, 3.32894013032151, 3.33873804207098, 3.34856989606653, 3.35843581964269, 3.36833594064947, 3.3782703874544, 3.3882392889447,
+		3.39824277452939, 3.40828097414139, 3.41835401823974, 3.42846203781167, 3.43860516437486, 3.44878352997939, 3.45899726721027, 3.46924650918941,
+
+		// alpha = 0.01, k1 = 5
+		5763.64955415571, 99.2992964778641, 28.2370808377551, 15.5218575444252, 10.967020650908, 8.74589525601992, 7.46043549298926, 6.63182516450959,
+		6.05694071411867, 5.63632618766908, 5.31600891860849, 5.06434311114292, 4.8616212079068, 4.69496357939772, 4.55561398465301, 4.4374204955396,
+		4.33593908318308, 4.24788215023173, 4.17076698061481, 4.10268463058473, 4.04214386117413, 3.98796322312694, 3.93919485474119, 3.89506965481708,
+		3.854957164663, 3.81833576278989, 3.78477021324144, 3.75389453883085, 3.72539880480221, 3.69901881141257, 3.67452797624245, 3.65173088300251,
+		3.63045811155867, 3.61056206229264, 3.59191355895147, 3.5743990660056, 3.55791839480653, 3.54238280135383, 3.52771339993043, 3.51383983313737,
+		3.50069915130601, 3.48823486385827, 3.47639613263499, 3.46513708303447, 3.45441621338578, 3.44419588660887, 3.43444189110293, 3.4251230601179,
+		3.41621094072764, 3.40767950503014, 3.39950489742669, 3.39166521283298, 3.38414030149697, 3.37691159677555, 3.36996196278229, 3.36327555928368,
+		3.35683772160959, 3.35063485366775, 3.34465433242538, 3.33888442244953, 3.33331419929299, 3.32793348067599, 3.32273276455434, 3.31770317328374,
+		3.31283640319176, 3.3081246789567, 3.30356071226712, 3.29913766430117, 3.29484911162029, 3.29068901512036, 3.28665169172536, 3.28273178854538,
+		3.27892425925209, 3.27522434245304, 3.27162754187032, 3.2681296081504, 3.26472652215081, 3.26141447956545, 3.25818987676551, 3.25504929774504,
+		3.25198950207213, 3.24900741375649, 3.2461001109531, 3.24326481642961, 3.24049888873235, 3.23779981399183, 3.23516519831428, 3.23259276071129,
+		3.23008032652338, 3.22762582129769, 3.22522726508383, 3.22288276711487, 3.22059052084354, 3.21834879930599, 3.21615595078853, 3.21401039477459,
+		3.21191061815028, 3.20985517165041, 3.20784266652679, 3.20587177142302, 3.20394120944077, 3.20204975538443, 3.200196233171, 3.19837951339435,
+		3.19659851103287, 3.19485218329085, 3.1931395275648, 3.19145957952568, 3.18981141131055, 3.18819412981516, 3.18660687508193, 3.18504881877656,
+		3.18351916274816, 3.18201713766689, 3.18054200173526, 3.17909303946758, 3.17766956053359, 3.17627089866325, 3.17489641060739, 3.17354547515235,
+		3.01725449384715, 3.02676784979798, 3.03631458497738, 3.0458948258739, 3.05550869946735, 3.06515633326148, 3.07483785528616, 3.0845533940994,
+		3.09430307878948, 3.10408703897709, 3.11390540481747, 3.12375830700253, 3.1336458767629, 3.14356824587037, 3.15352554663973, 3.16351791193117,
+
+		// alpha = 0.01, k1 = 6
+		5858.9861066862, 99.3325888654034, 27.910657357696, 15.2068648611575, 10.6722547924343, 8.4661253404769, 7.191404785204, 6.3706807302392,
+		5.80177030653513, 5.38581104484579, 5.06921043119526, 4.82057350188031, 4.62036339558485, 4.45582002592776, 4.31827305376703, 4.20163370427507,
+		4.10150532597661, 4.01463650735476, 3.93857261547994, 3.87142681512941, 3.81172549725481, 3.75830143500375, 3.71021836127777, 3.66671671794532,
+		3.62717396968155, 3.59107512639337, 3.5579905431887, 3.52755898891387, 3.49947458290277, 3.47347660866713, 3.44934149283827, 3.42687643169163,
+		3.40591428414407, 3.38630944749485, 3.36793450247132, 3.3506774654535, 3.33443952360791, 3.31913315686651, 3.30468057189688, 3.29101238929869,
+		3.27806653756564, 3.26578731683546, 3.25412460281153, 3.24303316699488, 3.23247209389237, 3.2224042794513, 3.21279599782556, 3.20361652586329,
+		3.19483781654691, 3.18643421410527, 3.17838220472819, 3.17066019780265, 3.16324833340164, 3.15612831242483, 3.14928324634383, 3.14269752396372,
+		3.13635669299589, 3.1302473545577, 3.12435706898291, 3.11867427155417, 3.11318819695994, 3.10788881144026, 3.10276675172461, 3.0978132699816,
+		3.09302018410202, 3.08837983272178, 3.08388503446655, 3.07952905096291, 3.07530555321623, 3.07120859100343, 3.06723256496985, 3.06337220115593,
+		3.05962252771022, 3.05597885357304, 3.05243674893923, 3.04899202732899, 3.04564072911448, 3.04237910636659, 3.03920360889949, 3.0361108714046,
+		3.03309770157572, 3.03016106913741, 3.02729809569769, 3.02450604535344, 3.02178231598461, 3.01912443117847, 3.01653003273188, 3.01399687368365,
+		3.01152281183378, 3.00910580371046, 3.00674389894896, 3.00443523505046, 3.00217803249047, 2.99997059015053, 2.99781128104849, 2.99569854834438,
+		2.99363090160205, 2.99160691328699, 2.9896252154836, 2.98768449681599, 2.98578349955717, 2.98392101691437, 2.98209589047697, 2.98030700781664,
+		2.97855330022878, 2.97683374060578, 2.97514734143305, 2.9734931529001, 2.9718702611183, 2.97027778643912, 2.96871488186582, 2.96718073155244,
+		2.96567454938551, 2.96419557764169, 2.96274308571832, 2.96131636893058, 2.9599147473729, 2.95853756483935, 2.95718418780022, 2.95585400443106,
+		2.80198230493153, 2.81134737734417, 2.82074543908817, 2.83017661670641, 2.83964103724002, 2.84913882826073, 2.85867011787287, 2.86823503471546,
+		2.87783370796423, 2.88746626733371, 2.89713284307927, 2.90683356599932, 2.91656856743723, 2.92633797928349, 2.93614193397808, 2.94598056451234,
+
+		// alpha = 0.01, k1 = 7
+		5928.35573158651, 99.3563737001873, 27.6716960703261, 14.9757577044467, 10.4555108917609, 8.25999527096898, 6.99283277871138, 6.17762426095225,
+		5.61286547737624, 5.20012125054997, 4.88607203921287, 4.63950244656434, 4.44099741066512, 4.27788185326564, 4.14154630703096, 4.02594659066507,
+		3.92671938827773, 3.84063865989798, 3.76526939463934, 3.69874015205505, 3.63958955821787, 3.58666022429485, 3.53902387787982, 3.49592752049327,
+		3.45675404663608, 3.42099299728861, 3.38821853687622, 3.35807265884722, 3.33025222958775, 3.3044988866924, 3.28059108523617, 3.25833777832715,
+		3.23757335378299, 3.21815354543183, 3.19995210729838, 3.18285808985557, 3.16677359508464, 3.15161191506982, 3.13729597989559, 3.12375705657342,
+		3.11093365292985, 3.09877058979251, 3.08721821211154, 3.07623171536052, 3.06577056805025, 3.05579801474315, 3.04628064678585, 3.03718803024359,
+		3.02849238234488, 3.02016828922044, 3.01219245892097, 3.0045435046785, 2.9972017541805, 2.9901490812883, 2.98336875718019, 2.97684531835427,
+		2.97056444930623, 2.96451287801428, 2.95867828263059, 2.9530492080027, 2.94761499083832, 2.94236569248781, 2.93729203845522, 2.9323853638655,
+		2.92763756421494, 2.92304105081761, 2.91858871043378, 2.91427386862971, 2.91009025647261, 2.90603198021222, 2.90209349364112, 2.89826957286207,
+		2.89455529322101, 2.89094600819237, 2.8874373300266, 2.88402511199055, 2.88070543205024, 2.87747457786087, 2.87432903294374, 2.8712654639421,
+		2.86828070885877, 2.86537176618858, 2.86253578486728, 2.85977005496613, 2.85707199906854, 2.85443916427113, 2.85186921475706, 2.84935992489453,
+		2.8469091728176, 2.84451493445039, 2.84217527793954, 2.83988835846259, 2.83765241338295, 2.83546575772516, 2.83332677994541, 2.83123393797574,
+		2.8291857555209, 2.82718081858958, 2.82521777224294, 2.82329531754453, 2.82141220869712, 2.81956725035368, 2.81775929508966, 2.81598724102589,
+		2.81425002959165, 2.81254664341776, 2.81087610435224, 2.80923747158879, 2.80762983990186, 2.80605233798077, 2.80450412685637, 2.80298439841456,
+		2.80149237399124, 2.80002730304299, 2.79858846188923, 2.79717515252141, 2.79578670147473, 2.79442245875913, 2.79308179684544, 2.7917641097036,
+		2.63932955805327, 2.64860773462068, 2.65791850719063, 2.66726200298754, 2.67663834973643, 2.68604767569478, 2.69549010965454, 2.70496578094409,
+		2.71447481943024, 2.72401735552024, 2.73359352016382, 2.74320344485527, 2.75284726163537, 2.76252510309343, 2.77223710236975, 2.78198339315721,
+
+		// alpha = 0.01, k1 = 8
+		5981.07030779774, 99.3742148189159, 27.4891770305362, 14.7988887906326, 10.2893110461359, 8.10165136673871, 6.84004907182935, 6.02887010661257,
+		5.46712251541477, 5.05669313174442, 4.74446764393547, 4.49936528084743, 4.30206201089645, 4.13994607512724, 4.00445318641694, 3.88957213992619,
+		3.79096417822419, 3.70542188117204, 3.63052458270226, 3.56441205329893, 3.5056317946182, 3.4530335271058, 3.40569473358384, 3.36286711994948,
+		3.32393746031516, 3.28839852123883, 3.25582716912726, 3.22586767654392, 3.19821884468868, 3.17262396351334, 3.14886290709596, 3.1267458534922,
+		3.10610825309976, 3.08680676569019, 3.06871595562621, 3.05172558540981, 3.03573838505014, 3.02066820255898, 3.00643846179793, 2.99298086976517,
+		2.9802343275403, 2.96814400845323, 2.95666057429968, 2.94573950609626, 2.93534053033063, 2.92542712519342, 2.91596609409122, 2.90692719599176,
+		2.89828282396524, 2.89000772475242, 2.88207875338279, 2.87447465784013, 2.86717588957168, 2.8601644362961, 2.85342367410973, 2.84693823634318,
+		2.84069389699717, 2.83467746690273, 2.82887670101474, 2.82328021547164, 2.81787741324257, 2.81265841734248, 2.80761401073239, 2.80273558213686,
+		2.79801507711076, 2.79344495377144, 2.78901814268583, 2.7847280104647, 2.78056832667064, 2.77653323369327, 2.77261721928597, 2.76881509149388,
+		2.76512195573396, 2.76153319381448, 2.75804444470544, 2.75465158689183, 2.75135072215961, 2.74813816068088, 2.74501040727825, 2.7419641487611,
+		2.7389962422375, 2.73610370431509, 2.73328370111337, 2.73053353901671, 2.72785065610521, 2.72523261420598, 2.72267709151296, 2.7201818757287,
+		2.71774485768524, 2.71536402540579, 2.71303745857178, 2.71076332336363, 2.70853986764609, 2.70636541647129, 2.7042383678759, 2.70215718894963,
+		2.70012041215518, 2.69812663188096, 2.69617450120965, 2.69426272888707, 2.69239007647664, 2.69055535568694, 2.68875742585958, 2.68699519160687,
+		2.68526760058824, 2.68357364141689, 2.68191234168703, 2.68028276611423, 2.6786840147812, 2.67711522148195, 2.67557555215828, 2.67406420342231,
+		2.67258040116006, 2.67112339920994, 2.66969247811307, 2.66828694392927, 2.66690612711591, 2.66554938146532, 2.66421608309695, 2.66290562950171,
+		2.51127937867837, 2.52051014140046, 2.52977307924543, 2.53906832093476, 2.54839599568414, 2.55775623323502, 2.56714916385654, 2.57657491834751,
+		2.58603362803845, 2.59552542479362, 2.60505044101301, 2.61460880963437, 2.62420066413542, 2.63382613853571, 2.64348536739893, 2.65317848583492,
+
+		// alpha = 0.01, k1 = 9
+		6022.47324496828, 99.3880927217145, 27.3452063335715, 14.6591335747389, 10.1577615479333, 7.97612136662336, 6.71875248182447, 5.91061884919086,
+		5.35112886114859, 4.94242065208861, 4.6315397476475, 4.38750996318019, 4.19107778181104, 4.02968033689587, 3.89478810712506, 3.78041516991357,
+		3.68224152404587, 3.59707391354575, 3.52250253991015, 3.45667563151716, 3.39814735764969, 3.34577275655153, 3.29863359737394, 3.25598507446139,
+		3.21721682624108, 3.18182399032743, 3.14938541065118, 3.11954702057365, 3.09200902510858, 3.06651590793499, 3.04284856390156, 3.02081804850987,
+		3.00026057010386, 2.9810334461915, 2.96301181438305, 2.9460859388305, 2.93015899022813, 2.91514520512577, 2.90096835112696, 2.88756044033362,
+		2.87486064547364, 2.86281438245124, 2.8513725302816, 2.84049076501618, 2.83012898870507, 2.82025083795769, 2.81082325946268, 2.80181614206795,
+		2.79320199682659, 2.784955677874, 2.77705413818801, 2.76947621525353, 2.76220244244834, 2.75521488262191, 2.74849698088149, 2.74203343404935,
+		2.73581007463102, 2.72981376744789, 2.72403231735123, 2.71845438665681, 2.71306942112687, 2.70786758348505, 2.70283969358541, 2.69797717447145,
+		2.69327200366026, 2.68871666907059, 2.68430412908686, 2.68002777631352, 2.67588140462788, 2.67185917918693, 2.66795560908336, 2.66416552238242,
+		2.66048404330086, 2.65690657131677, 2.65342876202257, 2.65004650955358, 2.64675593044318, 2.64355334877138, 2.64043528248714, 2.63739843079823,
+		2.63443966253215, 2.63155600538242, 2.62874463596244, 2.62600287059702, 2.62332815678892, 2.62071806530286, 2.61817028281585, 2.61568260508709,
+		2.61325293060515, 2.61087925467369, 2.60855966390114, 2.60629233106254, 2.60407551030404, 2.60190753266448, 2.59978680188917, 2.59771179051425,
+		2.59568103620142, 2.5936931383043, 2.59174675464994, 2.5898405985196, 2.58797343581449, 2.58614408239394, 2.58435140157312, 2.58259430176974,
+		2.58087173428963, 2.57918269124105, 2.57752620356995, 2.57590133920738, 2.57430720132202, 2.57274292667084, 2.57120768404154, 2.56970067278079,
+		2.56822112140295, 2.56676828627401, 2.56534145036621, 2.56393992207889, 2.5625630341214, 2.56121014245448, 2.55988062528642, 2.55857388212083,
+		2.40733270368888, 2.41654276941336, 2.42578454964028, 2.4350581755734, 2.44436377889082, 2.45370149177616, 2.46307144692081, 2.47247377752601,
+		2.48190861730504, 2.49137610048545, 2.50087636181124, 2.51040953654511, 2.51997576047064, 2.52957516989463, 2.53920790164934, 2.54887409309474,
+
+		// alpha = 0.01, k1 = 10
+		6055.84670739583, 99.3991959745395, 27.2287341214743, 14.5459008033234, 10.0510172195713, 7.87411853356562, 6.62006267029144, 5.81429385512266,
+		5.25654199128846, 4.84914680208003, 4.53928181125332, 4.29605440400905, 4.10026726236351, 3.93939637132463, 3.80493974595028, 3.69093141789517,
+		3.59306613360582, 3.50816172969927, 3.4338168829739, 3.36818638918874, 3.30982957161339, 3.25760556004923, 3.21059940593728, 3.16806896198365,
+		3.12940603858968, 3.09410756230367, 3.06175386149938, 3.03199210982697, 3.00452355523782, 2.97909356363389, 2.95548378029418, 2.9335059023711,
+		2.91299668952681, 2.89381393514448, 2.87583318936295, 2.85894507540373, 2.84305307770019, 2.8280717079301, 2.81392497579633, 2.80054510713269,
+		2.78787146394116, 2.77584963023588, 2.76443063476441, 2.75357028729975, 2.74322860962045, 2.73336934579806, 2.7239595391995, 2.7149691658442,
+		2.7063708155539, 2.69813941378639, 2.69025197822744, 2.6826874051806, 2.67542628158668, 2.66845071915826, 2.66174420765355, 2.6552914847636,
+		2.64907842045984, 2.64309191396221, 2.63731980175081, 2.63175077526475, 2.62637430711948, 2.6211805848315, 2.61616045117489, 2.61130535040824,
+		2.60660727970927, 2.60205874523808, 2.59765272232288, 2.5933826193239, 2.58924224478528, 2.58522577753114, 2.58132773940277, 2.57754297036877,
+		2.57386660577061, 2.57029405549315, 2.5668209848726, 2.56344329717544, 2.56015711749943, 2.55695877796395, 2.55384480407073, 2.55081190212871,
+		2.54785694764723, 2.54497697461165, 2.54216916556444, 2.53943084242166, 2.53675945796231, 2.5341525879336, 2.53160792372073, 2.5291232655349,
+		2.52669651607691, 2.52432567463842, 2.52200883160597, 2.51974416333567, 2.51752992737037, 2.51536445797225, 2.5132461619473, 2.51117351473952,
+		2.50914505677461, 2.50715939003499, 2.5052151748491, 2.5033111268796, 2.50144601429598, 2.4996186551192, 2.49782791472523, 2.49607270349765,
+		2.49435197461816, 2.49266472198605, 2.49100997825794, 2.48938681299946, 2.48779433094191, 2.4862316703367, 2.48469800140138, 2.483192524851,
+		2.48171447051035, 2.48026309600051, 2.4788376854965, 2.47743754855062, 2.47606201897778, 2.47471045379939, 2.47338223224157, 2.47207675478494,
+		2.3209251158668, 2.33013326180948, 2.33937261574294, 2.34864331249227, 2.35794548731787, 2.36727927594668, 2.37664481457483, 2.38604223987029,
+		2.39547168897557, 2.40493329951032, 2.4144272095741, 2.42395355774897, 2.43351248310234, 2.44310412518953, 2.45272862405665, 2.46238612024323,
+
+		// alpha = 0.025, k1 = 1
+		647.789011477846, 38.5063291139241, 17.4434433207251, 12.2178626330711, 10.0069821966136, 8.81310062867007, 8.07266888013557, 7.57088209969175,
+		7.20928324752202, 6.93672816629699, 6.72412966023919, 6.55376875300565, 6.41425430025059, 6.29793863110295, 6.1995009378011, 6.11512719770036,
+		6.04201334395712, 5.97805246478961, 5.92163126233666, 5.87149376580807, 5.82664776415983, 5.78629913300892, 5.74980482570434, 5.71663862751807,
+		5.68636580978177, 5.65862410043104, 5.63310920958783, 5.60956368814049, 5.58776825782233, 5.56753499651078, 5.5487019319178, 5.53112871565594,
+		5.51469313410029, 5.49928827322996, 5.4848201988686, 5.47120604629743, 5.45837243741656, 5.44625416179157, 5.43479307167525, 5.4239371515922,
+		5.41363973115527, 5.40385881604416, 5.39455651696848, 5.3856985602783, 5.37725386692612, 5.36919418889955, 5.36149379418118, 5.35412919284512,
+		5.34707889815978, 5.34032321758808, 5.33384406941002, 5.32762482137822, 5.32165014837904, 5.31590590653837, 5.3103790215987, 5.30505738971516,
+		5.29992978908797, 5.29498580107645, 5.29021573962785, 5.28561058801669, 5.28116194202681, 5.27686195882254, 5.27270331085709, 5.26867914424647,
+		5.2647830411146, 5.26100898547295, 5.25735133225438, 5.25380477916642, 5.25036434106833, 5.2470253266129, 5.24378331692124, 5.24063414608938,
+		5.23757388334374, 5.23459881668589, 5.23170543788369, 5.22889042868109, 5.22615064811246, 5.22348312082043, 5.22088502628436, 5.2183536888797,
+		5.21588656869272, 5.21348125302486, 5.21113544852844, 5.20884697391697, 5.20661375320459, 5.20443380942855, 5.20230525881497, 5.20022630535303,
+		5.19819523574321, 5.19621041469106, 5.19427028051784, 5.192373341065, 5.19051816986885, 5.18870340258442, 5.18692773364132, 5.18518991311259,
+		5.18348874378229, 5.18182307839554, 5.18019181707978, 5.17859390492455, 5.17702832970593, 5.17549411975097, 5.17399034192602, 5.17251609974555,
+		5.17107053159077, 5.1696528090306, 5.16826213523947, 5.16689774350438, 5.16555889581571, 5.16424488153675, 5.16295501614678, 5.16168864005094,
+		5.16044511745822, 5.15922383531513, 5.15802420229994, 5.15684564786757, 5.15568762134484, 5.15454959107353, 5.15343104359625, 5.15233148288471,
+		5.02388618729822, 5.03177630916012, 5.03968456208335, 5.04761099493623, 5.05555565671212, 5.06351859654648, 5.07149986371735, 5.0794995076457,
+		5.08751757789592, 5.09555412417628, 5.10360919633925, 5.11168284438221, 5.11977511844754, 5.1278860688229, 5.13601574594277, 5.14416420038758,
+
+		// alpha = 0.025, k1 = 2
+		799.499999999999, 39, 16.0441064292772, 10.6491106406735, 8.43362073943278, 7.25985568006018, 6.54152029709565, 6.05946743746348,
+		5.71470538638306, 5.45639552591273, 5.25588931192073, 5.09586716578394, 4.96526572290435, 4.85669786067517, 4.7650482838882, 4.68666540109795,
+		4.6188743275144, 4.55967171265201, 4.50752799516868, 4.46125549591925, 4.41991816642085, 4.3827684394668, 4.34920215470743, 4.31872580745245,
+		4.29093236699631, 4.26548316136889, 4.24209412653373, 4.22052524212474, 4.20057232525099, 4.18206059099611, 4.16483955170702, 4.1487789415422,
+		4.13376543387337, 4.11969997740237, 4.10649561920049, 4.09407571398886, 4.0823724420698, 4.0713255756233, 4.06088144616486, 4.0509920759367,
+		4.04161444367019, 4.03270986109327, 4.02424344118488, 4.0161836428124, 4.00850187925744, 4.00117218041731, 3.99417090029239, 3.98747646283453,
+		3.98106914041601, 3.97493086013867, 3.96904503398719, 3.96339640947238, 3.95797093793836, 3.95275565814489, 3.94773859309778, 3.94290865840157,
+		3.9382555806616, 3.93376982467323, 3.92944252831402, 3.92526544420496, 3.92123088733399, 3.91733168794309, 3.91356114907205, 3.90991300823075,
+		3.9063814027396, 3.90296083833442, 3.8996461606834, 3.89643252950545, 3.89331539501722, 3.89029047646772, 3.88735374254811, 3.88450139348865,
+		3.88172984467486, 3.87903571163544, 3.87641579626948, 3.87386707419521, 3.87138668311541, 3.86897191210516, 3.86662019173787, 3.86432908497446,
+		3.86209627874685, 3.85991957617574, 3.85779688936721, 3.85572623273819, 3.85370571682712, 3.8517335425478, 3.84980799585075, 3.84792744275859,
+		3.84609032474521, 3.84429515443098, 3.84254051156944, 3.84082503930277, 3.8391474406648, 3.83750647531298, 3.8359009564722, 3.83432974807443,
+		3.83279176207941, 3.83128595596333, 3.82981133036424, 3.82836692687106, 3.82695182594771, 3.82556514498229, 3.82420603645201, 3.8228736861972,
+		3.82156731179562, 3.82028616103111, 3.81902951045012, 3.81779666400002, 3.81658695174418, 3.81539972864894, 3.81423437343672, 3.81309028750289,
+		3.81196689389098, 3.81086363632254, 3.80977997827968, 3.80871540213484, 3.80766940832705, 3.80664151458067, 3.80563125516435, 3.80463818018719,
+		3.6888794540972, 3.69597595313655, 3.70309066055643, 3.71022362893987, 3.71737491101508, 3.72454455967262, 3.73173262796604, 3.73893916911227,
+		3.74616423649225, 3.75340788365141, 3.7606701643002, 3.7679511323147, 3.77525084173686, 3.78256934677537, 3.78990670180614, 3.79726296137285,
+
+		// alpha = 0.025, k1 = 3
+		864.162972163529, 39.1654945640136, 15.4391823787473, 9.97919853224388, 7.76358948201855, 6.59879852195647, 5.88981916720325, 5.41596233956024,
+		5.07811865222871, 4.82562149340541, 4.63002496182934, 4.47418480963775, 4.34717808270985, 4.24172763035919, 4.15280403006288, 4.07682306196248,
+		4.01116311807388, 3.95386336494896, 3.90342849182295, 3.85869866627321, 3.81876068059137, 3.78288585914206, 3.75048578952194, 3.72108019091511,
+		3.69427321314315, 3.66973569766867, 3.64719172375228, 3.62640828044847, 3.60718724981433, 3.58935912035186, 3.57277801064593, 3.55731769567155,
+		3.54286840798041, 3.52933424320517, 3.51663104087969, 3.50468464208619, 3.49342944807421, 3.48280722094489, 3.47276608030254, 3.46325965953484,
+		3.45424639288025, 3.44568891024222, 3.43755352123249, 3.42980977347259, 3.42243007298519, 3.4153893567317, 3.40866480913118, 3.40223561582363,
+		3.39608274909428, 3.39018878031186, 3.38453771549639, 3.37911485075772, 3.37390664485993, 3.36890060659144, 3.36408519497318, 3.35944973063003,
+		3.35498431689592, 3.35067976942839, 3.3465275532812, 3.34251972652911, 3.33864888966333, 3.33490814007957, 3.33129103107163, 3.32779153481804,
+		3.32440400891615, 3.32112316607293, 3.3179440466108, 3.31486199348828, 3.31187262957079, 3.30897183691925, 3.30615573789019, 3.3034206778655,
+		3.30076320944999, 3.29818007799349, 3.29566820830969, 3.29322469247808, 3.29084677862688, 3.28853186060683, 3.28627746847388, 3.28408125970792,
+		3.28194101110233, 3.27985461126468, 3.27782005367633, 3.27583543026218, 3.273898925428, 3.27200881052566, 3.27016343871106, 3.26836124016292,
+		3.26660071763262, 3.26488044229923, 3.26319904990529, 3.26155523715145, 3.25994775833007, 3.25837542217925, 3.25683708894123, 3.25533166760892,
+		3.25385811334747, 3.2524154250778, 3.25100264320997, 3.24961884751658, 3.24826315513473, 3.24693471868946, 3.24563272452831, 3.24435639106069,
+		3.24310496719432, 3.24187773086212, 3.2406739876338, 3.2394930694063, 3.23833433316823, 3.23719715983265, 3.23608095313531, 3.23498513859203,
+		3.23390916251407, 3.23285249107518, 3.23181460942925, 3.23079502087415, 3.22979324605957, 3.22880882223621, 3.22784130254285, 3.22689025533088,
+		3.11613453481532, 3.12291829573631, 3.12972026589855, 3.13654049910727, 3.1433790493219, 3.15023597067334, 3.15711131746449, 3.16400514417089,
+		3.17091750544117, 3.17784845609773, 3.18479805113722, 3.19176634573113, 3.19875339522641, 3.20575925514588, 3.21278398118909, 3.21982762923268,
+
+		// alpha = 0.025, k1 = 4
+		899.583310178039, 39.2484176581315, 15.1009789320459, 9.60452988472286, 7.38788575126775, 6.22716116435764, 5.52259434530855, 5.05263221736351,
+		4.71807845812819, 4.46834157822528, 4.27507159633661, 4.12120861852344, 3.99589755349417, 3.89191443776571, 3.80427134184101, 3.72941654559305,
+		3.66475409103621, 3.60834357189544, 3.55870609858558, 3.51469516225841, 3.47540846205265, 3.44012632634102, 3.40826783495206, 3.37935898773912,
+		3.3530092361483, 3.32889392588097, 3.30674098617346, 3.28632071546612, 3.26743785559113, 3.24992537856341, 3.23363956976298, 3.21845610289815,
+		3.20426688119733, 3.1909774759996, 3.17850503509123, 3.16677656335776, 3.15572750073212, 3.14530053919711, 3.13544463327508, 3.12611416809361,
+		3.11726825653093, 3.10887014268204, 3.10088669335641, 3.09328796282555, 3.08604681880685, 3.07913861986887, 3.07254093620037, 3.06623330709508,
+		3.06019702964425, 3.05441497405267, 3.048871421747, 3.04355192306287, 3.03844317180421, 3.03353289438717, 3.02880975162934, 3.02426325153317,
+		3.01988367165472, 3.01566198985161, 3.01158982237369, 3.00765936840466, 3.00386336028384, 3.00019501874108, 2.99664801256596, 2.9932164222068,
+		2.98989470686069, 2.98667767466969, 2.98356045568694, 2.98053847731667, 2.97760744196838, 2.97476330669567, 2.97200226461699, 2.96932072793945,
+		2.96671531242619, 2.9641828231664, 2.96172024152237, 2.95932471314132, 2.95699353693229, 2.95472415491869, 2.952514142886, 2.95036120175378,
+		2.94826314960625, 2.94621791432446, 2.94422352676749, 2.9422781144551, 2.94037989571009, 2.93852717422116, 2.93671833399193, 2.93495183464417,
+		2.93322620704683, 2.93154004924485, 2.92989202266358, 2.928280848568, 2.92670530475643, 2.92516422247108, 2.92365648350898, 2.92218101751816,
+		2.92073679946591, 2.91932284726528, 2.91793821955014, 2.91658201358642, 2.91525336331068, 2.91395143748749, 2.912675437976, 2.91142459809967,
+		2.91019818111111, 2.90899547874582, 2.90781580985928, 2.90665851914144, 2.90552297590325, 2.90440857293175, 2.90331472540762, 2.90224086988246,
+		2.9011864633119, 2.90015098213987, 2.89913392143268, 2.89813479405825, 2.89715312990866, 2.89618847516287, 2.89524039158771, 2.8943084558742,
+		2.78582169545276, 2.7924639789031, 2.79912442438898, 2.80580308630957, 2.81250001922459, 2.8192152778715, 2.82594891716613, 2.8327009922032,
+		2.83947155825691, 2.84626067078153, 2.85306838541194, 2.85989475796421, 2.86673984443628, 2.87360370100825, 2.88048638404338, 2.88738795008842,
+
+		// alpha = 0.025, k1 = 5
+		921.847903299708, 39.2982277754033, 14.884822920642, 9.3644708158083, 7.14638182873284, 5.98756512604693, 5.28523685150428, 4.81727555526553,
+		4.48441131418504, 4.23608566818863, 4.04399822206869, 3.89113393390239, 3.76667405523333, 3.66342311398309, 3.57641534927906, 3.50211633550588,
+		3.4379437009101, 3.38196780587524, 3.33271837280473, 3.28905584568041, 3.2500835876781, 3.21508658098901, 3.18348776023578, 3.15481634253311,
+		3.12868448362949, 3.10476981750297, 3.08280222170543, 3.0625536632068, 3.04383032055836, 3.02646640921589, 3.01031929588784, 2.99526559887376,
+		2.98119805004757, 2.96802295058564, 2.95565809350916, 2.94403105617532, 2.93307778814246, 2.92274143651965, 2.9129713635147, 2.90372232049415,
+		2.89495375024108, 2.88662919479812, 2.87871579072726, 2.87118383710222, 2.86400642430078, 2.85715911384912, 2.85061966131532, 2.8443677756506,
+		2.83838490950874, 2.83265407599142, 2.82715968801615, 2.82188741711597, 2.8168240689838, 2.81195747349099, 2.80727638725438, 2.80277040711333,
+		2.79842989311822, 2.79424589983317, 2.79021011492454, 2.78631480414973, 2.78255276198188, 2.77891726720806, 2.77540204292666, 2.7720012204437,
+		2.7687093066321, 2.76552115437253, 2.76243193574174, 2.75943711765528, 2.75653243970624, 2.7537138939728, 2.75097770659313, 2.7483203209305,
+		2.74573838216999, 2.74322872320749, 2.74078835170576, 2.7384144382069, 2.73610430520175, 2.73385541706764, 2.73166537079517, 2.72953188743261,
+		2.72745280418416, 2.72542606710436, 2.72344972433698, 2.72152191985141, 2.71964088763469, 2.71780494630082, 2.71601249408252, 2.71426200417479,
+		2.71255202040121, 2.71088115317742, 2.70924807574821, 2.70765152067699, 2.70609027656794, 2.704563185003, 2.70306913767762, 2.7016070737205,
+		2.70017597718313, 2.69877487468736, 2.69740283321915, 2.69605895805814, 2.69474239083317, 2.69345230769545, 2.6921879176003, 2.69094846069095,
+		2.68973320677665, 2.68854145389905, 2.6873725269812, 2.68622577655282, 2.6851005775481, 2.68399632816997, 2.6829124488177, 2.68184838107283,
+		2.68080358674058, 2.67977754694245, 2.67876976125764, 2.67777974690962, 2.67680703799512, 2.67585118475386, 2.67491175287514, 2.67398832284033,
+		2.56650039878942, 2.5730810528983, 2.57967975990548, 2.58629657478455, 2.59293155267407, 2.59958474889469, 2.60625621894971, 2.61294601852567,
+		2.61965420349283, 2.62638082990583, 2.63312595400419, 2.6398896322129, 2.64667192114293, 2.65347287759196, 2.66029255854477, 2.66713102117394,
+
+		// alpha = 0.025, k1 = 6
+		937.111083448202, 39.3314579624103, 14.7347184130392, 9.19731107936621, 6.97770185853557, 5.81975657896078, 5.11859661338411, 4.65169553730046,
+		4.31972183329289, 4.07213131505824, 3.88065116891005, 3.72829211539251, 3.60425639404683, 3.50136493600156, 3.41466465773577, 3.34063093954695,
+		3.27668904030836, 3.22091530748986, 3.17184420394343, 3.12833996189709, 3.08950899936072, 3.05463878343006, 3.02315428677001, 2.9945864110906,
+		2.96854871480925, 2.9447200078768, 2.92283116013263, 2.90265498091709, 2.88399836795425, 2.86669615397525, 2.85060623816725, 2.83560570033416,
+		2.82158767412404, 2.80845881195979, 2.79613721515686, 2.78455073268472, 2.77363555424888, 2.76333504000285, 2.75359874176087, 2.74438158015077,
+		2.73564314949284, 2.72734712787348, 2.71946077431065, 2.7119544983802, 2.70480149041456, 2.69797740256117, 2.69146007272795, 2.68522928483882,
+		2.6792665599497, 2.67355497369057, 2.66807899624389, 2.66282435168088, 2.65777789397881, 2.65292749745718, 2.64826195971459, 2.64377091543405,
+		2.63944475966323, 2.63527457937754, 2.63125209230084, 2.62736959210226, 2.62361989920735, 2.61999631656367, 2.61649258978903, 2.61310287120353,
+		2.60982168731162, 2.60664390935379, 2.60356472659549, 2.60057962206104, 2.59768435045521, 2.5948749180461, 2.59214756430889, 2.58949874515344,
+		2.58692511757847, 2.58442352561272, 2.5819909874192, 2.57962468345161, 2.57732194556403, 2.57508024698601, 2.57289719308334, 2.57077051283407,
+		2.56869805095577, 2.56667776062672, 2.5647076967496, 2.56278600971078, 2.56091093959367, 2.5590808108075, 2.55729402709753, 2.55554906690546,
+		2.55384447905142, 2.5521788787122, 2.55055094367188, 2.54895941082413, 2.54740307290602, 2.54588077544611, 2.54439141391078, 2.54293393103311,
+		2.54150731431193, 2.54011059366753, 2.53874283924337, 2.5374031593432, 2.53609069849334, 2.53480463562246, 2.53354418234948, 2.53230858137301,
+		2.53109710495493, 2.52990905349202, 2.52874375416931, 2.52760055969046, 2.52647884707925, 2.52537801654827, 2.52429749043011, 2.52323671216682,
+		2.52219514535485, 2.52117227284075, 2.52016759586568, 2.51918063325455, 2.51821092064822, 2.51725800977525, 2.5163214677613, 2.51540087647377,
+		2.40822922255823, 2.41479139552162, 2.42137144575707, 2.42796942913457, 2.43458540168998, 2.44121941964194, 2.44787153939249, 2.45454181752755,
+		2.46123031081751, 2.46793707621777, 2.4746621708693, 2.48140565209926, 2.48816757742141, 2.49494800453672, 2.5017469913342, 2.50856459589115,
+
+		// alpha = 0.025, k1 = 7
+		948.216889093935, 39.3552052921861, 14.6243950222413, 9.07414105156806, 6.85307562857665, 5.69547047368318, 4.99490921906324, 4.52856214736386,
+		4.19704663694551, 3.94982406893931, 3.75863791838007, 3.60651464222045, 3.48266932934266, 3.37993287765293, 3.29335981373231, 3.21943131832029,
+		3.15557709067936, 3.09987690169424, 3.05086787539848, 3.0074163305213, 2.96863033501069, 2.93379867151028, 2.90234736993234, 2.87380818803789,
+		2.84779538230485, 2.82398833571418, 2.80211839145297, 2.78195875217481, 2.76331664422774, 2.74602717634946, 2.72994848067903, 2.71495783454282,
+		2.70094853980025, 2.68782739271325, 2.6755126180731, 2.66393217123393, 2.6530223338791, 2.64272654594585, 2.63299442867079, 2.62378096326718,
+		2.61504579707739, 2.60675265471479, 2.59886883612852, 2.59136478699005, 2.58421372953629, 2.57739134417665, 2.57087549390674, 2.56464598496472,
+		2.55868435829177, 2.55297370727072, 2.54749851796054, 2.54224452865451, 2.53719860609001, 2.53234863605221, 2.52768342645722, 2.52319262128493,
+		2.5188666239715, 2.51469652907042, 2.51067406115985, 2.50679152011561, 2.50304173198954, 2.49941800483476, 2.49591408890654, 2.49252414074132,
+		2.48924269068024, 2.48606461345808, 2.48298510152526, 2.4799996408112, 2.47710398867248, 2.47429415379933, 2.47156637788065, 2.46891711885076,
+		2.46634303556064, 2.46384097373466, 2.46140795308879, 2.45904115549943, 2.45673791412474, 2.45449570338978, 2.45231212975673, 2.45018492320936,
+		2.44811192938791, 2.44609110231726, 2.44412049767695, 2.44219826656629, 2.44032264972285, 2.43849197215612, 2.43670463816209, 2.43495912668758,
+		2.43325398701594, 2.43158783474852, 2.42995934805855, 2.42836726419601, 2.42681037622406, 2.42528752996973, 2.42379762117192, 2.42233959281278,
+		2.42091243261822, 2.41951517071541, 2.41814687743615, 2.4168066612552, 2.41549366685404, 2.41420707330175, 2.41294609234404, 2.41170996679376,
+		2.4104979690155, 2.40930939949775, 2.40814358550759, 2.40699987982132, 2.40587765952697, 2.40477632489353, 2.40369529830257, 2.40263402323852,
+		2.40159196333397, 2.40056860146593, 2.39956343890048, 2.39857599448282, 2.39760580386936, 2.39665241880014, 2.39571540640844, 2.3947943485656,
+		2.28753775350228, 2.29410699855713, 2.30069387905977, 2.30729845233904, 2.313920775884, 2.32056090736074, 2.32721890461295, 2.33389482566249,
+		2.34058872871, 2.34730067213552, 2.35403071449901, 2.36077891454108, 2.36754533118347, 2.37433002352955, 2.38113305086541, 2.38795447265993,
+
+		// alpha = 0.025, k1 = 8
+		956.656220603105, 39.3730220687024, 14.5398865704172, 8.97958041501104, 6.75717200739468, 5.59962300504305, 4.89934064826824, 4.43325988918237,
+		4.10195569693975, 3.85489087968523, 3.66381903428787, 3.51177673631482, 3.38798732538961, 3.28528801862454, 3.19873807854076, 3.12482221430227,
+		3.06097275639898, 3.00527144567751, 2.956256888735, 2.91279652621012, 2.87399927955642, 2.83915458386986, 2.80768896989939, 2.77913458115311,
+		2.75310597194269, 2.72928275553268, 2.70739645320864, 2.68722040520922, 2.66856194387723, 2.65125625921801, 2.6351615452198, 2.62015512576777,
+		2.60613033721557, 2.59299400078674, 2.58066435869731, 2.56906937776815, 2.55814534644455, 2.54783570771878, 2.53809008297183, 2.52886345128782,
+		2.5201154561169, 2.5118098168267, 2.50391382709597, 2.49639792556522, 2.489235326892, 2.48240170352808, 2.47587491026937, 2.46963474502111,
+		2.463662740345, 2.45794198126622, 2.45245694556198, 2.44719336336163, 2.44213809338873, 2.43727901358933, 2.43260492423298, 2.42810546185875,
+		2.4237710226762, 2.41959269423196, 2.41556219431958, 2.41167181625307, 2.40791437974391, 2.40428318672375, 2.40077198154162, 2.3973749150383,
+		2.3940865120649, 2.39090164206615, 2.38781549239649, 2.38482354407742, 2.38192154973937, 2.37910551352195, 2.37637167273278, 2.37371648108791,
+		2.37113659337707, 2.36862885141441, 2.36619027115072, 2.36381803083677, 2.36150946013891, 2.359262030119, 2.3570733439994, 2.35494112864246,
+		2.35286322668055, 2.35083758923964, 2.34886226920489, 2.34693541498147, 2.34505526470891, 2.34322014089094, 2.34142844540619, 2.33967865486897,
+		2.33796931631149, 2.33629904316216, 2.33466651149608, 2.333070456537, 2.33150966939104, 2.32998299399418, 2.32848932425809, 2.32702760139866,
+		2.32559681143419, 2.32419598284067, 2.32282418435278, 2.32148052290019, 2.32016414166933, 2.31887421828225, 2.31760996308386, 2.31637061753074,
+		2.31515545267376, 2.3139637677291, 2.31279488873089, 2.31164816726071, 2.31052297924855, 2.30941872384058, 2.3083348223297, 2.3072707171444,
+		2.30622587089297, 2.30519976545836, 2.30419190114223, 2.30320179585341, 2.30222898433935, 2.30127301745748, 2.30033346148371, 2.29940989745667,
+		2.19181826741967, 2.19841067000775, 2.20502040225612, 2.21164752370373, 2.21829209403381, 2.2249541730905, 2.23163382087964, 2.23833109756951,
+		2.24504606349155, 2.25177877914119, 2.25852930517856, 2.26529770242919, 2.27208403188497, 2.27888835470466, 2.28571073221487, 2.29255122591076,
+
+		// alpha = 0.025, k1 = 9
+		963.284578946761, 39.3868832825514, 14.4730806517737, 8.90468161459859, 6.6810543464609, 5.52340662397559, 4.82321708462294, 4.35723306496021,
+		4.02599415828298, 3.77896263409158, 3.58789866910655, 3.43584564186106, 3.31203241005311, 3.20930034089668, 3.12271172630333, 3.04875345803668,
+		2.98485942891411, 2.92911249312326, 2.8800520467238, 2.83654608610481, 2.79770391950302, 2.76281524636826, 2.73130677293591, 2.70271075364237,
+		2.67664180685823, 2.65277957596707, 2.63085558792281, 2.61064317117007, 2.59194963395551, 2.57461013370308, 2.55848282615933, 2.54344499339652,
+		2.52938992792535, 2.51622440622826, 2.50386662570728, 2.4922445088916, 2.48129430087954, 2.47095940255346, 2.46118939461669, 2.45193921702993,
+		2.44316847574173, 2.43484085426735, 2.42692361207994, 2.41938715523745, 2.41220466739877, 2.40535179155118, 2.39880635450348, 2.3925481275902,
+		2.38655861815513, 2.38082088729426, 2.37531939008033, 2.37003983510006, 2.36496906063511, 2.36009492523119, 2.35540621074245, 2.35089253622303,
+		2.34654428127658, 2.34235251767357, 2.33830894821476, 2.33440585196069, 2.33063603506721, 2.32699278656905, 2.32346983854005, 2.3200613301329,
+		2.31676177506504, 2.31356603217118, 2.31046927869055, 2.3074669859971, 2.30455489751581, 2.30172900859907, 2.29898554816281, 2.29632096190589,
+		2.29373189695539, 2.29121518779856, 2.28876784337756, 2.28638703523611, 2.28407008661958, 2.28181446244028, 2.27961776002857, 2.27747770059937,
+		2.27539212136992, 2.2733589682719, 2.27137628920603, 2.26944222779263, 2.26755501757638, 2.26571297664689, 2.26391450264081, 2.26215806809446,
+		2.26044221611842, 2.25876555636835, 2.25712676128873, 2.25552456260837, 2.25395774806764, 2.25242515836055, 2.25092568427467, 2.2494582640146,
+		2.24802188069518, 2.24661555999197, 2.24523836793785, 2.24388940885504, 2.24256782341281, 2.24127278680252, 2.24000350702138, 2.23875922325739,
+		2.23753920436919, 2.23634274745349, 2.23516917649506, 2.23401784109324, 2.23288811526012, 2.23177939628595, 2.23069110366707, 2.22962267809256,
+		2.22857358048597, 2.22754329109846, 2.22653130865039, 2.22553714951816, 2.2245603469637, 2.22360045040392, 2.22265702471782, 2.22172964958888,
+		2.11364086650016, 2.12026698680546, 2.12691006992005, 2.13357017850173, 2.14024737532167, 2.14694172328124, 2.1536532854131, 2.16038212488239,
+		2.16712830498787, 2.17389188916309, 2.18067294097747, 2.18747152413758, 2.19428770248807, 2.20112154001303, 2.20797310083695, 2.21484244922597,
+
+		// alpha = 0.025, k1 = 10
+		968.627443676968, 39.3979745978644, 14.4189420421274, 8.84388097352143, 6.61915433142497, 5.46132371873179, 4.76111643499681, 4.29512696017259,
+		3.96386515762253, 3.71679186459737, 3.525671715888, 3.37355284983531, 3.24966795013312, 3.14686119355758, 3.06019685141125, 2.98616317443407,
+		2.92219496724492, 2.86637567883309, 2.81724507725838, 2.77367137519908, 2.7347639889588, 2.69981265138965, 2.66824405118467, 2.6395903910729,
+		2.61346621542759, 2.58955107974364, 2.56757641512109, 2.54731545034741, 2.52857539310827, 2.51119130135696, 2.49502123380379, 2.47994237879696,
+		2.46584793897862, 2.45264460512305, 2.44025049322007, 2.42859344869946, 2.41760964380762, 2.40724241070186, 2.39744126533038, 2.38816108668986,
+		2.37936142336513, 2.37100590491223, 2.36306174005431, 2.35549928711693, 2.34829168485871, 2.3414145340211, 2.33484562165241, 2.32856468165189,
+		2.32255318610261, 2.31679416287276, 2.31127203570758, 2.30597248364272, 2.30088231706942, 2.29598936819592, 2.2912823939913, 2.28675098998363,
+		2.28238551352247, 2.27817701531527, 2.27411717821562, 2.27019826238269, 2.26641305605178, 2.26275483125712, 2.25921730393587, 2.25579459791539,
+		2.25248121235021, 2.24927199222903, 2.24616210161962, 2.24314699935935, 2.24022241693472, 2.23738433832317, 2.23462898159716, 2.23195278211348,
+		2.22935237713039, 2.22682459171343, 2.22436642580544, 2.2219750423503, 2.21964775637146, 2.21738202491693, 2.21517543779154, 2.21302570900558,
+		2.21093066887603, 2.20888825672276, 2.20689651410859, 2.20495357857595, 2.20305767783853, 2.20120712438964, 2.19940031049274, 2.19763570352327,
+		2.19591184163278, 2.19422732971022, 2.19258083561659, 2.19097108667153, 2.18939686637282, 2.1878570113304, 2.18635040839916, 2.18487599199556,
+		2.18343274158418, 2.18201967932218, 2.18063586784993, 2.17928040821754, 2.17795243793729, 2.17665112915384, 2.17537568692285, 2.17412534759199,
+		2.17289937727605, 2.17169707042061, 2.17051774844805, 2.16936075848035, 2.16822547213395, 2.16711128438173, 2.16601761247785, 2.16494389494122,
+		2.16388959059466, 2.16285417765504, 2.16183715287246, 2.1608380307145, 2.15985634259331, 2.15889163613298, 2.15794347447431, 2.15701143561517,
+		2.04831773506556, 2.05498470928554, 2.0616682214213, 2.06836833829421, 2.07508512678827, 2.08181865386721, 2.08856898657652, 2.09533619204536,
+		2.10212033748844, 2.108921490208, 2.11573971759567, 2.12257508713433, 2.12942766640002, 2.13629752306366, 2.14318472489309, 2.15008933975468,
+
+		// alpha = 0.05, k1 = 1
+		161.447638797588, 18.5128205128205, 10.1279644860139, 7.70864742217679, 6.60789097370337, 5.98737760727371, 5.59144785122074, 5.31765507157872,
+		5.11735502919923, 4.96460274373071, 4.84433567494362, 4.74722534672252, 4.66719273182685, 4.60010993666942, 4.54307716526697, 4.49399847766636,
+		4.45132177246814, 4.41387341917057, 4.3807496923318, 4.35124350332928, 4.32479374318305, 4.30094950177765, 4.27934430914466, 4.25967727269024,
+		4.24169905027714, 4.22520127312748, 4.21000846835975, 4.19597181855777, 4.18296428905826, 4.1708767857667, 4.15961509803175, 4.14909744569955,
+		4.13925249555538, 4.13001774565202, 4.1213382003449, 4.11316527681289, 4.10545589723597, 4.09817173088084, 4.09127855799917, 4.08474573330165,
+		4.07854573129129, 4.07265375925059, 4.06704742642637, 4.06170646011932, 4.05661246110132, 4.05174869214921, 4.0470998945817, 4.04265212856666,
+		4.03839263368302, 4.034309706803, 4.03039259483556, 4.02663140026426, 4.02301699773367, 4.01954096020546, 4.01619549342842, 4.01297337765016,
+		4.00986791565357, 4.00687288633274, 4.00398250313063, 4.00119137675498, 3.99849448166805, 3.99588712591072, 3.99336492388211, 3.9909237717403,
+		3.98855982513639, 3.98626947902642, 3.9840493493388, 3.98189625630179, 3.97980720925735, 3.97777939281021, 3.97581015417558, 3.97389699160828,
+		3.97203754380523, 3.97022958018787, 3.96847099198037, 3.96675978400881, 3.96509406715353, 3.96347205139613, 3.96189203940519, 3.96035242061495,
+		3.9588516657515, 3.95738832176792, 3.95596100715446, 3.95456840758927, 3.95320927190383, 3.95188240833516, 3.95058668104147, 3.94932100686072,
+		3.94808435229166, 3.94687573068055, 3.94569419959623, 3.94453885838046, 3.94340884585915, 3.94230333820182, 3.94122154691961, 3.94016271699023,
+		3.93912612510149, 3.93811107800342, 3.93711691096281, 3.93614298631269, 3.9351886920872, 3.93425344074142, 3.93333666794402, 3.93243783144267,
+		3.93155640999492, 3.93069190236003, 3.9298438263491, 3.9290117179283, 3.92819513037234, 3.9273936334651, 3.92660681274443, 3.92583426878616,
+		3.92507561653043, 3.92433048463963, 3.92359851489404, 3.9228793616171, 3.92217269113088, 3.92147818124063, 3.9207955207447, 3.92012440897,
+		3.84145882068577, 3.84630665000351, 3.85116355499137, 3.85602955557265, 3.86090467170903, 3.86578892340903, 3.8706823307281, 3.87558491376877,
+		3.88049669268074, 3.88541768766102, 3.89034791895397, 3.89528740685167, 3.9002361716937, 3.90519423386707, 3.91016161380746, 3.915138331998,
+
+		// alpha = 0.05, k1 = 2
+		199.5, 19, 9.55209449592116, 6.94427190999916, 5.78613504334997, 5.14325284978472, 4.73741412777588, 4.45897010752451,
+		4.25649472909375, 4.1028210151304, 3.98229795709448, 3.88529383465239, 3.80556525297806, 3.73889183244073, 3.68232034367324, 3.63372346759163,
+		3.59153056847508, 3.55455714566179, 3.52189326057882, 3.49282847673564, 3.46680011154242, 3.44335677936672, 3.42213220786119, 3.4028261053502,
+		3.38518996144917, 3.36901635949544, 3.3541308285292, 3.34038555823776, 3.32765449857206, 3.31582950101352, 3.3048172521982, 3.29453681649115,
+		3.28491765103829, 3.27589799067239, 3.26742352474249, 3.25944630614411, 3.25192384638721, 3.24481836073281, 3.2380961351593, 3.23172699283085,
+		3.22568384229545, 3.21994229317613, 3.21448032788304, 3.2092780200492, 3.2043172921142, 3.19958170585199, 3.19505628073721, 3.19072733592849,
+		3.18658235236358, 3.18260985204279, 3.17879929205297, 3.17514097127489, 3.17162594803768, 3.16824596725133, 3.16499339576875, 3.16186116491304,
+		3.15884271926065, 3.15593197090048, 3.15312325849746, 3.15041131058273, 3.14779121256953, 3.14525837706149, 3.14280851707602, 3.14043762185429,
+		3.13814193497133, 3.1359179344946, 3.13376231497135, 3.13167197105082, 3.12964398257102, 3.12767560095915, 3.12576423681304, 3.12390744854578,
+		3.12210293198829, 3.12034851085735, 3.11864212800613, 3.1169818373831, 3.11536579663365, 3.11379226028483, 3.11225957346064, 3.11076616608047,
+		3.10931054749716, 3.10789130153726, 3.10650708190802, 3.10515660794, 3.10383866063768, 3.10255207901121, 3.1012957566672, 3.10006863863714,
+		3.09886971842434, 3.09769803525194, 3.09655267149625, 3.09543275029136, 3.09433743329115, 3.09326591857734, 3.09221743870236, 3.09119125885727,
+		3.0901866751549, 3.08920301302018, 3.08823962568077, 3.08729589274894, 3.08637121888997, 3.0854650325705, 3.08457678488049, 3.08370594842534,
+		3.08285201628181, 3.08201450101441, 3.081192933748, 3.08038686329261, 3.07959585531757, 3.07881949157167, 3.07805736914534, 3.07730909977415,
+		3.0765743091794, 3.07585263644377, 3.07514373342084, 3.07444726417474, 3.07376290444973, 3.07309034116712, 3.07242927194782, 3.07177940465873,
+		2.99573227354503, 3.00041131219407, 3.00510009763279, 3.00979865271378, 3.01450700033778, 3.01922516346279, 3.02395316510421, 3.02869102833502,
+		3.03343877628587, 3.03819643214532, 3.0429640191599, 3.04774156063438, 3.05252907993165, 3.05732660047317, 3.06213414573907, 3.06695173926837,
+
+		// alpha = 0.05, k1 = 3
+		215.707345369609, 19.1642921275113, 9.27662815314481, 6.59138211642558, 5.40945131805649, 4.75706266308941, 4.34683139990782, 4.06618055135116,
+		3.86254835762477, 3.70826481904684, 3.5874337024205, 3.49029481949761, 3.41053364462785, 3.34388867811891, 3.28738210463651, 3.23887151745359,
+		3.19677684094335, 3.15990758980072, 3.1273500051134, 3.09839121214078, 3.07246698639688, 3.04912498865241, 3.02799838233221, 3.00878657044736,
+		2.99124090954995, 2.97515396397339, 2.96035131841129, 2.94668526601727, 2.93402988966417, 2.92227719064504, 2.91133401371491, 2.90111958384084,
+		2.89156351734837, 2.88260420426122, 2.87418748350085, 2.86626555094018, 2.8587960539503, 2.8517413363299, 2.84506780527935, 2.83874539802064,
+		2.83274713024075, 2.82704871208613, 2.82162822021124, 2.81646581656568, 2.81154350633268, 2.80684492880626, 2.80235517609616, 2.7980606354356,
+		2.79394885158425, 2.7900084064022, 2.78622881314678, 2.78260042343461, 2.7791143451341, 2.77576236971909, 2.77253690783625, 2.76943093202314,
+		2.76643792566807, 2.76355183743277, 2.76076704046775, 2.75807829584257, 2.75548071969199, 2.75296975364429, 2.75054113815621, 2.74819088842618,
+		2.74591527259988, 2.74371079201765, 2.74157416328394, 2.73950230196599, 2.73749230775105, 2.73554145091296, 2.73364715995458, 2.73180701030923,
+		2.73001871399617, 2.72828011013796, 2.72658915625669, 2.72494392027591, 2.72334257316178, 2.72178338214537, 2.72026470447259, 2.71878498163493,
+		2.71734273403828, 2.71593655607119, 2.71456511153868, 2.71322712942988, 2.71192139999166, 2.71064677108257, 2.709402144784, 2.70818647424813,
+		2.70699876076266, 2.70583805101612, 2.70470343454725, 2.70359404136443, 2.70250903972215, 2.70144763404228, 2.70040906296979, 2.69939259755218,
+		2.698397539534, 2.69742321975817, 2.69646899666573, 2.69553425488815, 2.69461840392394, 2.69372087689573, 2.69284112938039, 2.69197863830836,
+		2.69113290092706, 2.69030343382388, 2.68948977200525, 2.68869146802766, 2.68790809117773, 2.68713922669717, 2.68638447505134, 2.68564345123657,
+		2.68491578412627, 2.68420111585074, 2.6834991012108, 2.68280940712193, 2.68213171208741, 2.68146570569915, 2.68081108816316, 2.68016756985029,
+		2.60490930107454, 2.60953714131703, 2.61417497580437, 2.61882282847604, 2.62348072332439, 2.6281486844039, 2.63282673583141, 2.63751490178628,
+		2.6422132065105, 2.64692167430891, 2.65164032954933, 2.65636919666275, 2.66110830014347, 2.66585766454919, 2.6706173145014, 2.6753872746854,
+
+		// alpha = 0.05, k1 = 4
+		224.583240626251, 19.246794344809, 9.11718225324642, 6.38823290869587, 5.19216777280392, 4.53367695027524, 4.12031172689763, 3.8378533545559,
+		3.63308851141908, 3.47804969076523, 3.35669002113259, 3.25916672690125, 3.17911705254019, 3.11224984796139, 3.05556827590659, 3.00691727992435,
+		2.96470811004108, 2.92774417280719, 2.89510730750784, 2.86608140201566, 2.84009980747539, 2.81670833964025, 2.79553873736139, 2.77628928925148,
+		2.75871046971763, 2.74259413722186, 2.72776530603399, 2.71407580414508, 2.70139933192326, 2.68962757369142, 2.6786671096568, 2.66843694251984,
+		2.65886650070406, 2.64989401446238, 2.64146518612856, 2.63353209421375, 2.6260522847654, 2.61898801371208, 2.61230561172839, 2.60597494912387,
+		2.59996898285732, 2.59426337134576, 2.58883614552394, 2.583667426803, 2.57873918431156, 2.57403502518322, 2.56954001276111, 2.56524050847904,
+		2.56112403389987, 2.55717914997636, 2.55339535107814, 2.54976297172092, 2.54627310425689, 2.54291752605266, 2.53968863490368, 2.53657939161829,
+		2.53358326886021, 2.5306942054681, 2.52790656557986, 2.52521510198287, 2.52261492318881, 2.52010146379908, 2.5176704577837, 2.51531791434443,
+		2.51304009607601, 2.51083349917348, 2.50869483546612, 2.50662101608375, 2.50460913658544, 2.50265646339995, 2.50076042144476, 2.49891858280631,
+		2.49712865637638, 2.49538847835198, 2.49369600351596, 2.4920492972244, 2.49044652803491, 2.48888596091696, 2.48736595099086, 2.48588493774887,
+		2.48444143971455, 2.48303404950299, 2.48166142924701, 2.48032230635759, 2.47901546959124, 2.47773976539794, 2.47649409452698, 2.47527740886963,
+		2.4740887085195, 2.47292703903344, 2.47179148887688, 2.47068118703974, 2.46959530080938, 2.46853303368891, 2.46749362344967, 2.46647634030811,
+		2.46548048521804, 2.46450538826899, 2.46355040718448, 2.46261492591166, 2.46169835329644, 2.46080012183864, 2.45991968652042, 2.45905652370415,
+		2.45821013009428, 2.45738002175902, 2.45656573320812, 2.45576681652289, 2.45498284053458, 2.45421339004915, 2.45345806511399, 2.45271648032501,
+		2.45198826417143, 2.45127305841486, 2.45057051750233, 2.44988030800955, 2.44920210811357, 2.44853560709239, 2.44788050485073, 2.44723651146934,
+		2.37193225918603, 2.37656238625022, 2.38120258270936, 2.38585287316493, 2.39051328227426, 2.39518383475999, 2.39986455541022, 2.40455546907865,
+		2.4092566006848, 2.41396797521409, 2.4186896177181, 2.42342155331464, 2.42816380718802, 2.432916404589, 2.43767937083529, 2.44245273131151,
+
+		// alpha = 0.05, k1 = 5
+		230.161878110107, 19.2964096520172, 9.01345516752259, 6.25605650216089, 5.05032905763264, 4.38737418740613, 3.97152315061134, 3.68749866634003,
+		3.48165865390152, 3.32583453041301, 3.20387426272962, 3.10587523908412, 3.02543830009826, 2.9582489131222, 2.90129453623616, 2.85240916508199,
+		2.8099961745296, 2.77285315299783, 2.74005754168535, 2.71088983720969, 2.68478073017485, 2.66127391711804, 2.639999426053, 2.62065414786289,
+		2.60298740278706, 2.58679008706259, 2.57188640578415, 2.55812750111081, 2.54538648794854, 2.53355454755927, 2.52253782528951, 2.51225494584814,
+		2.50263500741537, 2.49361595034691, 2.48514322137301, 2.47716867271091, 2.46964964929307, 2.46254822766705, 2.45583057797147, 2.44946642638871,
+		2.44342860009504, 2.43769264031165, 2.43223647186092, 2.42704011983391, 2.42208546571791, 2.41735603672041, 2.41283682313627, 2.40851411949933,
+		2.40437538598259, 2.40040912709929, 2.39660478523753, 2.39295264695503, 2.38944376028517, 2.38606986157422, 2.38282331059264, 2.37969703284918,
+		2.37668446819218, 2.37377952491314, 2.37097653867759, 2.36827023570106, 2.36565569966732, 2.36312834195233, 2.36068387477532, 2.3583182869463,
+		2.35602782192218, 2.35380895791904, 2.35165838985897, 2.34957301295768, 2.34754990778097, 2.34558632661923, 2.34367968104628, 2.34182753054429,
+		2.34002757208949, 2.33827763060556, 2.33657565020131, 2.33491968611872, 2.33330789732492, 2.33173853968885, 2.33020995968946, 2.32872058860788,
+		2.32726893716046, 2.32585359053438, 2.32447320379092, 2.32312649760483, 2.3218122543119, 2.32052931423878, 2.31927657229155, 2.31805297478266,
+		2.31685751647643, 2.3156892378361, 2.31454722245628, 2.31343059466676, 2.31233851729429, 2.31127018957007, 2.31022484517251, 2.30920175039493,
+		2.30820020242864, 2.30721952775372, 2.30625908062911, 2.30531824167524, 2.30439641654243, 2.30349303465945, 2.30260754805606, 2.30173943025517,
+		2.30088817522929, 2.30005329641721, 2.29923432579717, 2.29843081301187, 2.29764232454334, 2.29686844293292, 2.29610876604475, 2.29536290636897,
+		2.29463049036303, 2.29391115782779, 2.29320456131731, 2.2925103655793, 2.29182824702469, 2.29115789322525, 2.29049900243619, 2.2898512831436,
+		2.21409953869405, 2.21875790097419, 2.22342629358971, 2.2281047418818, 2.2327932712484, 2.23749190715367, 2.24220067512811, 2.2469196007687,
+		2.2516487097391, 2.25638802776981, 2.2611375806583, 2.26589739426921, 2.27066749453444, 2.27544790745349, 2.28023865909343, 2.28503977558918,
+
+		// alpha = 0.05, k1 = 6
+		233.986000356266, 19.329534015154, 8.94064512077038, 6.16313228268863, 4.95028806869432, 4.28386571382264, 3.86596885312385, 3.58058031976146,
+		3.37375364703921, 3.21717454739899, 3.09461288790914, 2.99612037751711, 2.91526923870275, 2.84772599592536, 2.7904649973675, 2.74131082833878,
+		2.69865990162987, 2.6613045229279, 2.62831803833851, 2.5989777115642, 2.57271164050953, 2.54906141384366, 2.52765532524218, 2.50818882342325,
+		2.49041001808741, 2.47410878077096, 2.45910844257833, 2.44525939508939, 2.43243410457679, 2.42052318855758, 2.40943229983527, 2.39907963069847,
+		2.38939389798814, 2.38031270436763, 2.37178119636682, 2.36375095836614, 2.35617909552602, 2.34902746906353, 2.34226205515828, 2.33585240479166,
+		2.32977118646126, 2.32399379731183, 2.31849803103543, 2.31326379310511, 2.3082728556567, 2.30350864572642, 2.29895606166801, 2.29460131347063,
+		2.29043178342518, 2.28643590417802, 2.28260305169255, 2.27892345103561, 2.27538809323145, 2.27198866169597, 2.26871746698794, 2.26556738880071,
+		2.26253182427418, 2.25960464183839, 2.25678013991002, 2.25405300985703, 2.25141830272571, 2.24887139929158, 2.24640798305342, 2.24402401583812,
+		2.24171571572708, 2.23947953704994, 2.23731215222366, 2.23521043524134, 2.23317144663835, 2.23119241978412, 2.22927074836493, 2.22740397493915,
+		2.22558978045872, 2.22382597466334, 2.22211048726378, 2.2204413598396, 2.21881673838454, 2.21723486644031, 2.21569407876491, 2.21419279548791,
+		2.21272951670937, 2.21130281750348, 2.20991134329243, 2.20855380555825, 2.20722897786487, 2.20593569216392, 2.20467283536126, 2.20343934612306,
+		2.20223421190193, 2.20105646616579, 2.19990518581344, 2.19877948876255, 2.19767853169634, 2.19660150795728, 2.19554764557688, 2.19451620543071,
+		2.19350647951043, 2.19251778930331, 2.19154948427229, 2.19060094042906, 2.18967155899322, 2.18876076513249, 2.18786800677708, 2.1869927535043,
+		2.18613449548785, 2.18529274250784, 2.18446702301718, 2.18365688326113, 2.18286188644586, 2.18208161195346, 2.18131565460005, 2.18056362393411,
+		2.17982514357334, 2.17909985057628, 2.17838739484804, 2.17768743857654, 2.17699965569883, 2.17632373139461, 2.17565936160589, 2.17500625258102,
+		2.09859787394823, 2.10329820314003, 2.10800843394342, 2.11272859280024, 2.11745870620588, 2.1221988007186, 2.12694890295973, 2.13170903961381,
+		2.13647923742884, 2.14125952321642, 2.14604992385192, 2.15085046627479, 2.15566117748858, 2.16048208456113, 2.16531321462506, 2.17015459487764,
+
+		// alpha = 0.05, k1 = 7
+		236.768400276995, 19.3532175360929, 8.88674295563428, 6.09421092569889, 4.875871695834, 4.20665848786921, 3.78704353992807, 3.50046385504494,
+		3.29274583891712, 3.13546480462632, 3.0123303430431, 2.9133581790112, 2.83209750163494, 2.76419925677818, 2.7066267822257, 2.65719660022109,
+		2.61429904513332, 2.57672172925992, 2.54353430142971, 2.51401106299883, 2.48757770372204, 2.46377382996081, 2.44222608568486, 2.42262853342092,
+		2.40472810810058, 2.38831367802511, 2.3732077116306, 2.35925985405644, 2.34634192202056, 2.33434396484478, 2.32317113592033, 2.31274118663375,
+		2.30298244297972, 2.29383215982389, 2.28523517310187, 2.2771427888981, 2.26951186223609, 2.26230402884393, 2.25548506106756, 2.24902432514739,
+		2.24289432172927, 2.23707029509303, 2.2315298994038, 2.22625291251176, 2.22122098958233, 2.21641745023812, 2.21182709401382, 2.20743603982636,
+		2.20323158589284, 2.19920208712115, 2.19533684748306, 2.19162602527675, 2.18806054951359, 2.18463204593454, 2.18133277138719, 2.17815555548128,
+		2.17509374859864, 2.17214117546413, 2.16929209359628, 2.16654115604942, 2.16388337793911, 2.16131410631014, 2.15882899296422, 2.1564239699135,
+		2.15409522716883, 2.15183919260756, 2.14965251369741, 2.1475320408797, 2.14547481243885, 2.14347804070535, 2.14153909945703, 2.13965551239919,
+		2.1378249426169, 2.13604518290547, 2.13431414689493, 2.13262986089314, 2.1309904563811, 2.12939416309987, 2.12783930267582, 2.12632428273578,
+		2.12484759146861, 2.12340779259435, 2.12200352070573, 2.12063347695014, 2.11929642502358, 2.11799118745046, 2.11671664212578, 2.11547171909837,
+		2.1142553975758, 2.11306670313333, 2.11190470511089, 2.11076851418347, 2.10965728009143, 2.10857018951908, 2.10750646410958, 2.10646535860686,
+		2.10544615911452, 2.10444818146355, 2.10347076968111, 2.10251329455279, 2.10157515227195, 2.10065576317029, 2.09975457052341, 2.0988710394269,
+		2.09800465573786, 2.09715492507697, 2.09632137188835, 2.09550353855184, 2.09470098454552, 2.09391328565455, 2.09314003322349, 2.0923808334494,
+		2.09163530671337, 2.09090308694745, 2.09018382103538, 2.08947716824493, 2.0887827996896, 2.08810039781842, 2.08742965593176, 2.08677027772161,
+		2.00959149275396, 2.01434144874893, 2.01910110191384, 2.02387048034944, 2.02864961219979, 2.03343852566144, 2.03823724898374, 2.04304581046912,
+		2.04786423847339, 2.052692561406, 2.05753080773032, 2.06237900596404, 2.06723718467928, 2.07210537250283, 2.0769835981169, 2.08187189025882,
+
+		// alpha = 0.05, k1 = 8
+		238.882694802524, 19.3709928980665, 8.84523845995941, 6.04104447611915, 4.81831953565687, 4.14680416227653, 3.72572531712271, 3.43810123337316,
+		3.22958261268677, 3.07165838527904, 2.94799031863864, 2.84856514206768, 2.76691318191775, 2.69867241870931, 2.6407968829069, 2.5910961798744,
+		2.54795535776986, 2.51015789538358, 2.47677014745129, 2.44706374797982, 2.42046219735446, 2.39650328376392, 2.37481212582063, 2.35508149484621,
+		2.3370572240603, 2.32052723503375, 2.30531317742743, 2.29126398414416, 2.27825084905155, 2.26616327413814, 2.25490592966663, 2.24439613880004,
+		2.23456184651355, 2.22533996743809, 2.2166750326752, 2.20851807433467, 2.20082570047383, 2.19355932358176, 2.18668451368331, 2.18017045320064,
+		2.17398947537927, 2.16811667170984, 2.16252955660827, 2.15720777984416, 2.15213287897063, 2.14728806541198, 2.14265803898998, 2.138228826574,
+		2.13398764127267, 2.12992275917974, 2.12602341117328, 2.12227968766647, 2.1186824545366, 2.11522327873162, 2.11189436227888, 2.10868848360981,
+		2.10559894527116, 2.10261952722671, 2.09974444506405, 2.09696831251595, 2.09428610778541, 2.09169314323144, 2.08918503803104, 2.08675769348138,
+		2.08440727065012, 2.08213017011701, 2.07992301358218, 2.07778262714344, 2.07570602606858, 2.07369040090899, 2.07173310481874, 2.06983164195887,
+		2.06798365687998, 2.06618692478821, 2.06443934260998, 2.06273892078022, 2.06108377568633, 2.05947212270803, 2.05790226979854, 2.05637261155898,
+		2.05488162376201, 2.05342785828571, 2.05200993842225, 2.0506265545292, 2.04927645999494, 2.04795846749181, 2.04667144549331, 2.04541431503413,
+		2.04418604669317, 2.04298565778221, 2.04181220972362, 2.04066480560284, 2.03954258788207, 2.03844473626263, 2.03737046568546, 2.03631902445877,
+		2.0352896925039, 2.03428177971077, 2.03329462439481, 2.03232759184844, 2.03138007297993, 2.03045148303424, 2.02954126038934, 2.02864886542372,
+		2.02777377944929, 2.02691550370625, 2.02607355841499, 2.02524748188182, 2.02443682965467, 2.02364117372568, 2.02286010177768, 2.02209321647156,
+		2.02134013477263, 2.0206004873121, 2.0198739177835, 2.01916008237, 2.01845864920205, 2.01776929784296, 2.01709171880058, 2.01642561306419,
+		1.93841413197452, 1.94321808238091, 1.94803145908367, 1.95285429255427, 1.95768661328664, 1.96252845180631, 1.96737983867099, 1.97224080447109,
+		1.97711137983029, 1.98199159540604, 1.98688148189013, 1.99178107000911, 1.99669039052504, 2.00160947423571, 2.00653835197542, 2.0114770546154,
+
+		// alpha = 0.05, k1 = 9
+		240.543254713263, 19.3848257181715, 8.81229955520645, 5.99877903121025, 4.77246561310086, 4.09901554171652, 3.67667469893951, 3.38813023473973,
+		3.17889310445827, 3.02038294702138, 2.89622276128771, 2.79637548949925, 2.71435578905989, 2.64579073523382, 2.58762643522759, 2.53766653888065,
+		2.4942914945642, 2.45628114915927, 2.42269893712397, 2.39281410844228, 2.36604819203545, 2.34193732766579, 2.32010524231663, 2.30024352251484,
+		2.28209698519891, 2.26545267434728, 2.25013147720267, 2.23598166067029, 2.22287383392996, 2.21069698330358, 2.19935532233105, 2.18876576806951,
+		2.17885590307662, 2.1695623174523, 2.16082925076653, 2.15260747245807, 2.1448533532506, 2.13752809062368, 2.13059705932852, 2.1240292640167,
+		2.11779687573283, 2.11187483765592, 2.10624052831391, 2.10087347272968, 2.09575509372528, 2.09086849701858, 2.08619828487478, 2.08173039398212,
+		2.07745195395624, 2.07335116347463, 2.06941718153067, 2.06564003169706, 2.06201051761845, 2.05852014822618, 2.05516107139493, 2.0519260149498,
+		2.04880823409124, 2.04580146443754, 2.04289987999703, 2.04009805547648, 2.03739093241261, 2.03477378868192, 2.03224221100185, 2.0297920700867,
+		2.02741949816383, 2.02512086859271, 2.02289277736077, 2.02073202625763, 2.01863560755257, 2.01660069002104, 2.01462460618335, 2.012704840635,
+		2.01083901936092, 2.00902489993822, 2.00726036254263, 2.00554340168251, 2.00387211859277, 2.00224471422819, 2.00065948280133, 1.99911480581684,
+		1.99760914655774, 1.99614104498451, 1.99470911301134, 1.9933120301272, 1.9919485393331, 1.99061744336875, 1.98931760120525, 1.98804792478192,
+		1.98680737596793, 1.98559496373052, 1.98440974149382, 1.9832508046737, 1.98211728837442, 1.98100836523565, 1.97992324341792, 1.97886116471652,
+		1.97782140279435, 1.97680326152487, 1.97580607343766, 1.97482919825877, 1.97387202153933, 1.97293395336665, 1.97201442715142, 1.97111289848622,
+		1.97022884407065, 1.96936176069798, 1.96851116429998, 1.96767658904555, 1.96685758648977, 1.96605372477031, 1.96526458784795, 1.96448977478837,
+		1.96372889908284, 1.96298158800513, 1.96224748200265, 1.96152623411945, 1.96081750944938, 1.96012098461743, 1.95943634728773, 1.95876329569639,
+		1.87988640050503, 1.88474680985871, 1.88961631497851, 1.89449494954571, 1.89938274722846, 1.90427974169116, 1.90918596659557, 1.91410145560184,
+		1.91902624236957, 1.92396036055881, 1.92890384383112, 1.93385672585058, 1.93881904028472, 1.94379082080557, 1.94877210109063, 1.95376291482383,
+
+		// alpha = 0.05, k1 = 10
+		241.881747250833, 19.3958967235717, 8.78552471052401, 5.96437055223804, 4.73506306969342, 4.0599627943307, 3.63652312062835, 3.34716312023398,
+		3.1372801078887, 2.97823701608232, 2.85362485827325, 2.75338676883586, 2.67102422855513, 2.60215505104271, 2.54371854969281, 2.49351322128161,
+		2.44991550039425, 2.41170203983392, 2.37793368728983, 2.34787756699831, 2.32095343930744, 2.29669595693772, 2.27472758503325, 2.2547388307326,
+		2.23647358105051, 2.21971807368516, 2.20429249277265, 2.19004448887475, 2.17684412830235, 2.16457991712548, 2.15315564230577, 2.1424878405746,
+		2.13250375421675, 2.12313966790113, 2.11433954620339, 2.10605391026112, 2.09823890599309, 2.09085552682776, 2.08386896185623, 2.07724804641721,
+		2.07096479681518, 2.06499401451558, 2.05931294800756, 2.05390100276449, 2.0487394915052, 2.04381141837064, 2.03910129176148, 2.03459496149189,
+		2.03027947665216, 2.02614296117111, 2.02217450455913, 2.01836406571424, 2.01470238800431, 2.01118092411308, 2.00779176936444, 2.00452760242991,
+		2.00138163248254, 1.99834755199411, 1.99541949448479, 1.99259199662941, 1.98985996420512, 1.98721864143344, 1.98466358332868, 1.98219063071399,
+		1.97979588760973, 1.97747570073525, 1.97522664089731, 1.9730454860655, 1.97092920595892, 1.96887494798897, 1.96688002442099, 1.96494190063349,
+		1.9630581843665, 1.9612266158637, 1.95944505882246, 1.95771149207571, 1.95602400193756, 1.95438077515155, 1.95278009238699, 1.9512203222343,
+		1.94969991565526, 1.94821740084832, 1.9467713784935, 1.94536051734418, 1.94398355013687, 1.9426392697924, 1.94132652588456, 1.9400442213547,
+		1.93879130945211, 1.93756679088272, 1.93636971114957, 1.93519915806992, 1.93405425945613, 1.93293418094698, 1.93183812397888, 1.93076532388626,
+		1.92971504812152, 1.92868659458613, 1.92767929006466, 1.92669248875456, 1.92572557088465, 1.92477794141673, 1.92384902882353, 1.92293828393911,
+		1.92204517887549, 1.921169206002, 1.92030987698277, 1.91946672186839, 1.91863928823868, 1.91782714039284, 1.9170298585842, 1.91624703829625,
+		1.91547828955843, 1.91472323629772, 1.9139815157252, 1.91325277775451, 1.91253668445059, 1.91183290950716, 1.91114113775061, 1.9104610646692,
+		1.83070380531953, 1.83562198503594, 1.84054887556645, 1.84548451475083, 1.85042894036092, 1.85538219011071, 1.86034430165824, 1.86531531260766,
+		1.87029526051112, 1.87528418287068, 1.88028211714021, 1.8852891007272, 1.89030517099464, 1.89533036526272, 1.90036472081076, 1.90540827487877,
+
+		// alpha = 0.1, k1 = 1
+		39.8634581890614, 8.52631578947368, 5.53831945626223, 4.54477072037127, 4.06041994687207, 3.77594960258353, 3.5894280908648, 3.45791890388501,
+		3.36030302387155, 3.28501532170377, 3.22520228205166, 3.17654893102243, 3.1362050930216, 3.10221339438336, 3.07318554959385, 3.04810981108787,
+		3.02623156140564, 3.00697659179542, 2.9899002798798, 2.97465301746376, 2.96095613757746, 2.94858480246571, 2.93735561362201, 2.92711749135522,
+		2.91774486025022, 2.90913248820395, 2.9011915293305, 2.89384645551648, 2.88703265229656, 2.88069451716171, 2.87478394196581, 2.86925909190093,
+		2.86408341558129, 2.85922483677922, 2.85465509008965, 2.85034917149206, 2.84628488128242, 2.84244244175616, 2.83880417576137, 2.83535423511153,
+		2.83207837006218, 2.82896373279062, 2.8259987091657, 2.82317277417171, 2.82047636719098, 2.81790078404287, 2.81543808319986, 2.81308100406497,
+		2.81082289553453, 2.80865765336685, 2.80657966512008, 2.80458376160775, 2.8026651739929, 2.80081949577346, 2.79904264901385, 2.79733085428505,
+		2.79568060384778, 2.7940886376704, 2.79255192194605, 2.79106762980724, 2.78963312397709, 2.78824594114254, 2.78690377783952, 2.78560447769995,
+		2.7843460198927, 2.78312650864103, 2.78194416369899, 2.78079731168134, 2.77968437816679, 2.77860388048622, 2.77755442114059, 2.77653468176764,
+		2.77554341762054, 2.77457945250146, 2.77364167410655, 2.7727290297453, 2.77184052240172, 2.77097520709851, 2.77013218755097, 2.76931061306631,
+		2.76850967568222, 2.76772860752078, 2.76696667832691, 2.76622319319901, 2.76549749047099, 2.76478893974853, 2.76409694008672, 2.76342091828712,
+		2.76276032731712, 2.7621146448305, 2.7614833717949, 2.76086603120249, 2.76026216686732, 2.75967134230555, 2.75909313967984, 2.75852715881599,
+		2.75797301627615, 2.75743034449813, 2.75689879098019, 2.7563780175117, 2.75586769946885, 2.7553675251249, 2.75487719502711, 2.7543964213934,
+		2.75392492754856, 2.75346244739718, 2.75300872491944, 2.75256351370032, 2.75212657648388, 2.75169768475083, 2.75127661831629, 2.75086316496543,
+		2.75045712007782, 2.75005828630877, 2.74966647325585, 2.74928149716193, 2.74890318062973, 2.74853135234371, 2.74816584681497, 2.7478065041325,
+		2.70554345409191, 2.70815616198045, 2.7107726707293, 2.71339298676936, 2.71601711653945, 2.71864506648985, 2.72127684308223, 2.72391245278983,
+		2.72655190209734, 2.72919519750098, 2.73184234550891, 2.73449335263941, 2.73714822542353, 2.73980697040674, 2.74246959413965, 2.74513610318885,
+
+		// alpha = 0.1, k1 = 2
+		49.5, 9, 5.46238325041917, 4.32455532033676, 3.77971607877395, 3.46330407009565, 3.25744205109137, 3.11311764015569,
+		3.00645241740026, 2.92446596230557, 2.85951095624113, 2.80679560573242, 2.76316735696949, 2.72646846061196, 2.69517293158894, 2.66817145730659,
+		2.6446384680833, 2.62394698513396, 2.60561236417977, 2.58925411794167, 2.57456938971784, 2.56131413386273, 2.54928951346311, 2.53833190354306,
+		2.52830543271766, 2.51909634228767, 2.51060866655854, 2.50276088711022, 2.49548331423546, 2.48871601769748, 2.48240717696956, 2.47651175503134,
+		2.47099042406265, 2.46580868895079, 2.46093616739811, 2.45634599494304, 2.45201433032702, 2.44791994200909, 2.44404386071492, 2.44036908603927,
+		2.43688033754215, 2.43356384266272, 2.43040715525173, 2.42739899968803, 2.42452913646847, 2.4217882458985, 2.4191678271029, 2.41666011005302,
+		2.41425797869517, 2.41195490357964, 2.40974488264836, 2.40762238905183, 2.40558232504032, 2.40361998112071, 2.40173099979054, 2.39991134326173,
+		2.39815726467129, 2.39646528234758, 2.39483215675992, 2.39325486983129, 2.39173060633571, 2.39025673713983, 2.38883080407863, 2.38745050628215,
+		2.38611368779398, 2.38481832634069, 2.38356252312981, 2.38234449356792, 2.3811625588035, 2.38001513801016, 2.3789007413359, 2.37781796345252,
+		2.37676547764581, 2.3757420303948, 2.37474643639355, 2.37377757397355, 2.37283438089004, 2.37191585043851, 2.37102102787184, 2.37014900709156,
+		2.36929892758822, 2.3684699716102, 2.36766136154082, 2.36687235746586, 2.36610225491647, 2.36535038277174, 2.36461610130863, 2.36389880038721,
+		2.36319789776039, 2.36251283749799, 2.36184308851658, 2.36118814320694, 2.36054751615121, 2.35992074292337, 2.35930737896673, 2.35870699854285,
+		2.35811919374612, 2.35754357357959, 2.3569797630884, 2.35642740254498, 2.35588614668402, 2.35535566398312, 2.3548356359854, 2.35432575666255,
+		2.35382573181425, 2.35333527850216, 2.35285412451627, 2.35238200787115, 2.35191867633029, 2.35146388695725, 2.35101740569032, 2.3505790069414,
+		2.35014847321605, 2.34972559475335, 2.34931016918573, 2.3489020012156, 2.34850090230949, 2.34810669040786, 2.34771918964964, 2.3473382301102,
+		2.30258509298997, 2.30534870735197, 2.30811674519702, 2.31088921449517, 2.3136661232277, 2.31644747939125, 2.31923329099778, 2.32202356607467,
+		2.32481831266473, 2.32761753882621, 2.33042125263286, 2.33322946217402, 2.33604217555437, 2.33885940089427, 2.34168114632978, 2.34450742001268,
+
+		// alpha = 0.1, k1 = 3
+		53.5932446586713, 9.16179016817973, 5.39077328032978, 4.19086043887225, 3.61947741253959, 3.28876156345824, 3.074071993909, 2.92379628831378,
+		2.81286299718239, 2.72767314116507, 2.66022868376531, 2.60552492083068, 2.56027289819034, 2.52222359753478, 2.48978773387781, 2.46181075324355,
+		2.43743391457984, 2.41600537717794, 2.39702150344995, 2.3800870510696, 2.36488752983564, 2.35116960007935, 2.33872691170118, 2.32738970121198,
+		2.31701703333883, 2.30749093524253, 2.29871190607198, 2.29059543999741, 2.28306930567571, 2.27607139696831, 2.26954801976722, 2.26345251511402,
+		2.25774414406826, 2.2523871780789, 2.24735015200922, 2.24260524687735, 2.238127776781, 2.23389576005879, 2.22988955898828, 2.22609157557688,
+		2.22248599351823, 2.21905855834435, 2.21579638933817, 2.21268781798049, 2.2097222486658, 2.20689003818672, 2.20418239110226, 2.20159126860034,
+		2.19910930886735, 2.19672975730504, 2.19444640520305, 2.1922535356955, 2.1901458760122, 2.18811855518544, 2.18616706649901, 2.18428723407043,
+		2.18247518304538, 2.18072731295685, 2.179040273864, 2.17741094493783, 2.17583641520654, 2.17431396620988, 2.17284105634617, 2.17141530672156,
+		2.17003448833664, 2.16869651046495, 2.16739941009599, 2.166141342331, 2.16492057163218, 2.16373546383876, 2.1625844788721, 2.16146616406204,
+		2.16037914803294, 2.15932213509608, 2.15829390009962, 2.15729328369367, 2.15631918797131, 2.15537057245193, 2.15444645037533, 2.15354588527919,
+		2.15266798783499, 2.15181191291951, 2.15097685690234, 2.15016205513041, 2.14936677959343, 2.14859033675513, 2.14783206553656, 2.14709133543966,
+		2.14636754479911, 2.14566011915301, 2.1449685097227, 2.14429219199341, 2.14363066438797, 2.14298344702651, 2.1423500805661, 2.1417301251136,
+		2.14112315920708, 2.14052877886072, 2.13994659666807, 2.13937624096063, 2.13881735501626, 2.1382695963158, 2.13773263584295, 2.13720615742551,
+		2.13668985711479, 2.13618344260038, 2.13568663265858, 2.13519915663161, 2.13472075393629, 2.13425117359919, 2.13379017381829, 2.13333752154717,
+		2.132892992103, 2.13245636879417, 2.13202744256836, 2.13160601167883, 2.13119188136799, 2.13078486356769, 2.13038477661392, 2.12999144497703,
+		2.08379621038583, 2.08664822672109, 2.08950489408253, 2.0923662210783, 2.09523221632945, 2.09810288847432, 2.1009782461685, 2.10385829808492,
+		2.10674305291382, 2.10963251936287, 2.11252670615711, 2.11542562203905, 2.11832927576868, 2.12123767612342, 2.12415083189837, 2.1270687519062,
+
+		// alpha = 0.1, k1 = 4
+		55.832961122513, 9.24341649025257, 5.34264447848147, 4.10724954225052, 3.52019624553412, 3.18076286505832, 2.9605340887351, 2.80642570613764,
+		2.69268006250234, 2.60533643134858, 2.53618823220683, 2.48010209357268, 2.43370534094074, 2.39469210420602, 2.36143311586946, 2.33274486935363,
+		2.30774713299584, 2.28577177241807, 2.26630256748804, 2.24893440177304, 2.23334492577725, 2.21927446493125, 2.20651150510033, 2.19488203032552,
+		2.18424157125816, 2.17446919343144, 2.16546289513097, 2.15713604396102, 2.14941458864781, 2.1422348562885, 2.13554179653999, 2.12928757045225,
+		2.12343040755159, 2.11793367353168, 2.11276510463933, 2.10789617500046, 2.10330157072108, 2.09895875032109, 2.09484757541114, 2.09094999885992,
+		2.08724980027797, 2.0837323606503, 2.08038446952227, 2.07719415938317, 2.07415056287543, 2.07124378924223, 2.06846481705688, 2.06580540078456,
+		2.06325798913999, 2.06081565353972, 2.0584720252223, 2.05622123983598, 2.05405788847935, 2.05197697433497, 2.04997387416483, 2.04804430404338,
+		2.04618428879372, 2.04439013466883, 2.04265840488239, 2.04098589764888, 2.03936962643738, 2.03780680218344, 2.036294817236, 2.03483123084497,
+		2.03341375602013, 2.03204024761201, 2.03070869148466, 2.02941719466503, 2.02816397636795, 2.02694735980724, 2.0257657647135, 2.0246177004889,
+		2.02350175993623, 2.02241661350679, 2.02136100401811, 2.02033374179674, 2.01933370020722, 2.01835981153184, 2.01741106316895, 2.01648649412241,
+		2.01558519175554, 2.01470628878712, 2.01384896050883, 2.01301242220458, 2.01219592675572, 2.011398762416, 2.01062025074286, 2.00985974467213,
+		2.00911662672477, 2.00839030733531, 2.00768022329208, 2.00698583628116, 2.00630663152561, 2.00564211651311, 2.00499181980516, 2.00435528992183,
+		2.00373209429696, 2.00312181829761, 2.00252406430467, 2.00193845084897, 2.00136461179943, 2.00080219560024, 2.0002508645524, 1.99971029413791,
+		1.9991801723829, 1.9986601992572, 1.99815008610833, 1.99764955512735, 1.99715833884406, 1.99667617965104, 1.99620282935278, 1.99573804873984,
+		1.99528160718615, 1.99483328226689, 1.99439285939765, 1.99396013149173, 1.99353489863571, 1.99311696778126, 1.99270615245332, 1.99230227247239,
+		1.94486008492938, 1.94778957320278, 1.95072377177275, 1.95366268976215, 1.9566063363074, 1.95955472056291, 1.96250785170104, 1.96546573891217,
+		1.96842839140475, 1.9713958184053, 1.97436802915845, 1.97734503292698, 1.9803268389919, 1.98331345665228, 1.98630489522561, 1.98930116404764,
+
+		// alpha = 0.1, k1 = 5
+		57.2400771323514, 9.29262634632168, 5.30915701949683, 4.05057906898747, 3.4529822480379, 3.10751166663893, 2.88334449567821, 2.72644691539053,
+		2.61061255002997, 2.52164068620962, 2.4511843429748, 2.39402225684223, 2.3467237551113, 2.30694305140072, 2.27302244786757, 2.24375760368383,
+		2.21825264878412, 2.19582746752374, 2.17595649656505, 2.15822722016843, 2.14231134886675, 2.12794438184794, 2.11491084122426, 2.10303342400756,
+		2.09216491108067, 2.0821820493193, 2.07298086765609, 2.06447304988195, 2.05658309622865, 2.04924608068577, 2.04240586315858, 2.03601365239852,
+		2.03002684198136, 2.02440806068102, 2.01912439255369, 2.01414673237973, 2.0094492498334, 2.00500894157227, 2.00080525486776, 1.99681976979384,
+		1.99303592961527, 1.98943881105876, 1.98601492775079, 1.98275206136785, 1.97963911604618, 1.97666599239734, 1.97382347811755, 1.9711031526958,
+		1.96849730414597, 1.96599885602909, 1.96360130331271, 1.96129865584356, 1.95908538839967, 1.95695639644582, 1.95490695684667, 1.95293269290144,
+		1.95102954315559, 1.94919373352189, 1.94742175230856, 1.94571032780652, 1.94405640813538, 1.94245714308667, 1.94090986773735, 1.93941208763534,
+		1.93796146538403, 1.93655580847403, 1.93519305822872, 1.93387127974684, 1.93258865273842, 1.93134346316308, 1.93013409558965, 1.92895902620596,
+		1.92781681641467, 1.92670610695899, 1.92562561252764, 1.9245741167941, 1.92355046785004, 1.92255357399652, 1.9215823998611, 1.92063596281151,
+		1.91971332963989, 1.91881361349405, 1.91793597103464, 1.91707959979882, 1.91624373575345, 1.91542765102199, 1.91463065177062, 1.91385207624116,
+		1.9130912929188, 1.91234769882393, 1.91162071791838, 1.91090979961753, 1.91021441739979, 1.90953406750619, 1.90886826772346, 1.90821655624457,
+		1.90757849060035, 1.90695364665799, 1.90634161768086, 1.90574201344578, 1.90515445941326, 1.90457859594762, 1.90401407758277, 1.90346057233137,
+		1.90291776103372, 1.90238533674414, 1.90186300415241, 1.90135047903729, 1.90084748775125, 1.90035376673304, 1.89986906204741, 1.89939312894944,
+		1.89892573147276, 1.89846664203917, 1.89801564108947, 1.89757251673327, 1.89713706441687, 1.89670908660881, 1.89628839250083, 1.89587479772434,
+		1.84727137995194, 1.85027377185587, 1.85328082721385, 1.85629255585608, 1.85930896762476, 1.86233007237844, 1.86535587999207, 1.86838640035705,
+		1.87142164338123, 1.87446161898902, 1.87750633712137, 1.88055580773589, 1.88361004080674, 1.88666904632494, 1.88973283429814, 1.89280141475084,
+
+		// alpha = 0.1, k1 = 6
+		58.2044164305558, 9.32553045463928, 5.28473156008055, 4.00974931267395, 3.40450658498497, 3.05455068245892, 2.82739227103129, 2.66833472364645,
+		2.55085524861529, 2.46058196744724, 2.38906656169326, 2.33102356578799, 2.28297944218515, 2.24255856929495, 2.20808177033144, 2.17832880439543,
+		2.15239175278377, 2.12958118637396, 2.10936421832454, 2.09132248779091, 2.07512297876139, 2.06049732388535, 2.04722684943822, 2.03513158635824,
+		2.02406207270672, 2.01389315420473, 2.00451923703875, 1.99585061106677, 1.98781057212215, 1.98033314793237, 1.97336128496243, 1.96684539077448,
+		1.96074215316671, 1.95501357666894, 1.94962619111574, 1.94455039748454, 1.93975992400782, 1.93523137146738, 1.93094383106594, 1.92687856171272,
+		1.92301871621887, 1.91934910796845, 1.915856011253, 1.91252698973663, 1.90935074853456, 1.90631700619772, 1.90341638354717, 1.90064030682646,
+		1.89798092306571, 1.8954310258981, 1.89298399035334, 1.89063371538563, 1.88837457308673, 1.88620136369418, 1.88410927563765, 1.88209384997726,
+		1.88015094868068, 1.87827672626441, 1.87646760438985, 1.87472024906147, 1.87303155012119, 1.8713986027735, 1.86981869091102, 1.86828927203834,
+		1.86680796361898, 1.86537253069049, 1.8639808746129, 1.86263102283107, 1.8613211195459, 1.86004941720189, 1.85881426870849, 1.85761412032303,
+		1.85644750513003, 1.85531303705952, 1.8542094053933, 1.85313536971317, 1.85208975524993, 1.85107144859726, 1.8500793937566, 1.84911258848441,
+		1.84817008091466, 1.84725096643276, 1.84635438477963, 1.84547951736585, 1.84462558477903, 1.84379184446764, 1.84297758858741, 1.84218214199702,
+		1.84140486039094, 1.84064512855893, 1.83990235876189, 1.83917598921563, 1.83846548267367, 1.83777032510188, 1.83709002443854, 1.83642410943241,
+		1.83577212855432, 1.83513364897597, 1.83450825561171, 1.83389555021878, 1.8332951505513, 1.83270668956535, 1.83212981467044, 1.83156418702513,
+		1.83100948087328, 1.83046538291853, 1.82993159173399, 1.82940781720571, 1.82889378000661, 1.82838921109995, 1.82789385126974, 1.82740745067646,
+		1.8269297684373, 1.82646057222796, 1.82599963790624, 1.82554674915461, 1.82510169714203, 1.82466428020271, 1.82423430353146, 1.82381157889441,
+		1.77410677927389, 1.77717891472451, 1.78025558767493, 1.78333680904479, 1.78642258975995, 1.78951294075674, 1.79260787298211, 1.79570739739369,
+		1.79881152495987, 1.80192026665993, 1.8050336334841, 1.80815163643372, 1.81127428652124, 1.81440159477023, 1.81753357221585, 1.82067022990461,
+
+		// alpha = 0.1, k1 = 7
+		58.9059532421413, 9.34908116554972, 5.26619463976651, 3.97896624379538, 3.36789874849111, 3.01445650474309, 2.78493011750444, 2.62413487356119,
+		2.50531320155499, 2.41396509984671, 2.34156567658958, 2.28278048240478, 2.23410296032996, 2.19313429107524, 2.15817844753549, 2.12800260888755,
+		2.1016892470828, 2.0785414489425, 2.05802040094765, 2.03970298058623, 2.02325229745849, 2.00839679631528, 1.99491515412859, 1.98262518037924,
+		1.97137553535034, 1.9610394658457, 1.95151000747601, 1.94269626805949, 1.93452051824965, 1.92691589201682, 1.91982455289318, 1.91319621952326,
+		1.90698697098758, 1.90115827186819, 1.89567617130648, 1.89051064087416, 1.88563502397862, 1.88102557548239, 1.87666107475054, 1.87252249881635,
+		1.86859274504376, 1.86485639475619, 1.8612995109418, 1.85790946443788, 1.85467478402421, 1.85158502667421, 1.84863066487093, 1.84580298842536,
+		1.84309401866522, 1.84049643321329, 1.83800349986116, 1.83560901828078, 1.83330726851093, 1.83109296531714, 1.82896121765865, 1.82690749260745,
+		1.8249275831596, 1.8230175794571, 1.82117384300648, 1.81939298353585, 1.81767183818092, 1.81600745273091, 1.8143970647005, 1.81283808802353,
+		1.81132809919005, 1.80986482467058, 1.80844612948999, 1.80707000683044, 1.80573456855665, 1.80443803656968, 1.80317873490551, 1.80195508250529,
+		1.8007655865907, 1.79960883658695, 1.7984834985408, 1.79738830998742, 1.79632207522449, 1.79528366095628, 1.79427199227437, 1.79328604894524,
+		1.79232486197735, 1.79138751044382, 1.79047311853855, 1.78958085284621, 1.78870991980799, 1.78785956336706, 1.78702906277896, 1.78621773057371,
+		1.78542491065737, 1.78464997654218, 1.78389232969512, 1.78315139799584, 1.78242663429545, 1.7817175150689, 1.78102353915336, 1.78034422656698,
+		1.77967911740146, 1.77902777078339, 1.77838976389971, 1.77776469108215, 1.7771521629468, 1.77655180558532, 1.77596325980341, 1.77538618040417,
+		1.77482023551292, 1.77426510594034, 1.77372048458243, 1.77318607585363, 1.77266159515189, 1.77214676835324, 1.77164133133385, 1.77114502951807,
+		1.77065761745112, 1.7701788583939, 1.76970852393965, 1.76924639365062, 1.76879225471335, 1.76834590161207, 1.76790713581843, 1.76747576549697,
+		1.71671951767893, 1.71985874021722, 1.72300231006199, 1.72615023974095, 1.72930254177547, 1.73245922868477, 1.7356203129862, 1.73878580719547,
+		1.74195572382684, 1.74513007539341, 1.74830887440726, 1.75149213337983, 1.75467986482197, 1.7578720812441, 1.76106879515687, 1.76427001907084,
+
+		// alpha = 0.1, k1 = 8
+		59.4389805664772, 9.36677032737029, 5.25167108152147, 3.95493994454235, 3.33927571115434, 2.9830356142905, 2.75157957735359, 2.58934905572564,
+		2.46940565262622, 2.37715002264051, 2.30399745828859, 2.24457494789101, 2.19534973563983, 2.15390445389172, 2.11852950153795, 2.0879818512371,
+		2.06133612551985, 2.03788925853555, 2.0170975349095, 1.99853387139914, 1.98185813765625, 1.96679609914989, 1.95312419570991, 1.94065835262197,
+		1.92924563081438, 1.91875790988452, 1.90908704913414, 1.90014113832823, 1.89184156223992, 1.88412068010343, 1.8769199747657, 1.87018856423694,
+		1.86388199546739, 1.85796125982726, 1.85239198415892, 1.84714376192393, 1.84218959693108, 1.83750543813855, 1.8330697885945, 1.82886337508655,
+		1.82486886778088, 1.82107064124167, 1.81745456987553, 1.81400785215045, 1.81071885897465, 1.80757700244745, 1.80457262185837, 1.80169688434615,
+		1.79894169806448, 1.79629963605458, 1.79376386931557, 1.79132810780137, 1.78898654827007, 1.78673382807471, 1.78456498412049, 1.78247541632673,
+		1.78046085502694, 1.77851733182057, 1.77664115345744, 1.77482887839278, 1.77307729569979, 1.77138340606751, 1.76974440464748, 1.76815766554224,
+		1.76662072775579, 1.76513128244724, 1.7636871613489, 1.76228632622671, 1.76092685927489, 1.75960695434978, 1.75832490895858, 1.75707911692805,
+		1.75586806168694, 1.75469031010288, 1.75354450682118, 1.75242936905848, 1.75134368180896, 1.75028629342584, 1.74925611154399, 1.74825209931353,
+		1.74727327191691, 1.74631869334504, 1.74538747341032, 1.74447876497612, 1.74359176138518, 1.74272569407006, 1.74187983033082, 1.7410534712667,
+		1.74024594984911, 1.73945662912522, 1.73868490054143, 1.73793018237792, 1.73719191828576, 1.73646957591829, 1.73576264565065, 1.73507063938009,
+		1.73439308940159, 1.73372954735328, 1.7330795832266, 1.7324427844367, 1.73181875494856, 1.73120711445551, 1.73060749760587, 1.73001955327517,
+		1.72944294387994, 1.72887734473144, 1.72832244342551, 1.72777793926714, 1.72724354272691, 1.7267189749274, 1.72620396715779, 1.72569826041467,
+		1.72520160496781, 1.72471375994835, 1.72423449295966, 1.72376357970774, 1.7233008036512, 1.72284595566932, 1.72239883374657, 1.72195924267362,
+		1.6701957670602, 1.67339970303615, 1.67660774132554, 1.67981989669126, 1.68303618386744, 1.68625661756383, 1.68948121246627, 1.69270998323726,
+		1.69594294451648, 1.69918011092126, 1.70242149704718, 1.7056671174684, 1.70891698673845, 1.71217111939033, 1.71542952993736, 1.71869223287348,
+
+		// alpha = 0.1, k1 = 9
+		59.8575851459904, 9.38054404832639, 5.23999586113573, 3.93567081503525, 3.3162808188556, 2.95774070396694, 2.72467772155827, 2.56123820965702,
+		2.44034043770947, 2.34730590975052, 2.27350198196504, 2.21352454495326, 2.16381957944086, 2.1219545669769, 2.08620874923267, 2.05533065874033,
+		2.02838838945045, 2.00467372996192, 1.98363884402051, 1.96485330226169, 1.94797422440855, 1.93272509188929, 1.91888042951593, 1.90625454338692,
+		1.89469311495899, 1.88406684048825, 1.87426655781345, 1.86519946991077, 1.85678618762315, 1.84895839146416, 1.84165696637561, 1.83483050145092,
+		1.82843407392716, 1.82242825651786, 1.81677830164146, 1.81145346682132, 1.80642645354845, 1.80167293794465, 1.79717117616606, 1.79290167101694,
+		1.78884688897276, 1.78499101893664, 1.78131976571912, 1.77782017254553, 1.77448046793893, 1.77128993315931, 1.76823878704935, 1.76531808567656,
+		1.76251963459946, 1.75983591194317, 1.75726000076119, 1.75478552940125, 1.7524066187912, 1.75011783572559, 1.74791415137096, 1.74579090432154,
+		1.74374376763376, 1.74176871934831, 1.73986201607663, 1.73802016928637, 1.7362399239695, 1.73451823941831, 1.73285227187001, 1.73123935881162,
+		1.72967700476257, 1.72816286837519, 1.72669475071265, 1.72527058458106, 1.72388842480633, 1.72254643936007, 1.72124290124871, 1.71997618109088,
+		1.71874474031553, 1.71754712492092, 1.71638195974175, 1.71524794317621, 1.71414384233086, 1.71306848854517, 1.71202077326123, 1.71099964420842,
+		1.71000410187491, 1.70903319624147, 1.70808602375501, 1.70716172452144, 1.70625947969979, 1.70537850908068, 1.70451806883425, 1.70367744941386,
+		1.70285597360317, 1.70205299469516, 1.70126789479274, 1.70050008322216, 1.69974899504953, 1.69901408969385, 1.69829484962847, 1.69759077916486,
+		1.69690140331267, 1.69622626671023, 1.69556493262098, 1.69491698199074, 1.69428201256145, 1.69365963803817, 1.69304948730478, 1.6924512036855,
+		1.69186444424945, 1.69128887915455, 1.69072419102906, 1.69017007438762, 1.68962623507983, 1.68909238976939, 1.68856826544156, 1.68805359893732,
+		1.68754813651262, 1.68705163342096, 1.6865638535181, 1.68608456888731, 1.68561355948416, 1.68515061279948, 1.68469552353955, 1.68424809332238,
+		1.63151739702538, 1.63478388403301, 1.63805418012849, 1.64132830302805, 1.64460627038367, 1.6478880997877, 1.65117380877393, 1.65446341481866,
+		1.65775693534177, 1.66105438770775, 1.66435578922671, 1.66766115715549, 1.67097050869845, 1.67428386100865, 1.6776012311887, 1.68092263629176,
+
+		// alpha = 0.1, k1 = 10
+		60.1949803440463, 9.3915727801497, 5.23041127055523, 3.91987560373121, 3.29740166802993, 2.93693467084833, 2.70251048176804, 2.53803678155033,
+		2.4163155830609, 2.32260394089131, 2.24822999836509, 2.18776407887509, 2.13763458883327, 2.0953964206458, 2.05931949615682, 2.02814526136692,
+		2.00093630142992, 1.97698004248415, 1.95572513870368, 1.93673829870798, 1.91967428054137, 1.90425459648336, 1.89025211430578, 1.87747973419601,
+		1.86578193591643, 1.85502838168504, 1.84510901413245, 1.83593025688829, 1.82741203883424, 1.81948544091496, 1.81209081863217, 1.80517629166288,
+		1.79869651946828, 1.79261170162818, 1.78688675619274, 1.78149064012102, 1.77639578393317, 1.77157761878372, 1.76701417879039, 1.76268576500323,
+		1.7585746601442, 1.75466488538417, 1.75094199210099, 1.74739288288412, 1.74400565710171, 1.74076947718425, 1.73767445245248, 1.7347115378603,
+		1.73187244546492, 1.72914956679547, 1.72653590458559, 1.72402501257813, 1.72161094230916, 1.71928819594513, 1.71705168438438, 1.71489668994984,
+		1.71281883309632, 1.71081404263701, 1.70887852906277, 1.70700876058535, 1.70520144158587, 1.70345349319079, 1.70176203573484, 1.7001243729,
+		1.69853797734668, 1.69700047767575, 1.69550964657978, 1.69406339005883, 1.69265973759079, 1.69129683315904, 1.68997292705153, 1.68868636835503,
+		1.68743559807644, 1.68621914283127, 1.68503560904512, 1.68388367762034, 1.68276209902489, 1.68166968876478, 1.68060532320568, 1.67956793571271,
+		1.67855651308041, 1.67757009222767, 1.67660775713528, 1.67566863600513, 1.67475189862291, 1.67385675390733, 1.67298244763064, 1.67212826029682,
+		1.67129350516456, 1.6704775264039, 1.66967969737603, 1.6688994190265, 1.66813611838383, 1.66738924715469, 1.66665828040925, 1.6659427153496,
+		1.66524207015529, 1.66455588290028, 1.66388371053655, 1.66322512793924, 1.66257972700908, 1.66194711582868, 1.66132691786777, 1.66071877123567,
+		1.66012232797624, 1.65953725340357, 1.65896322547528, 1.6583999342008, 1.65784708108285, 1.65730437858954, 1.65677154965546, 1.65624832720933,
+		1.65573445372778, 1.65522968081198, 1.65473376878727, 1.65424648632331, 1.65376761007395, 1.65329692433587, 1.65283422072423, 1.65237929786485,
+		1.59871791720735, 1.60204497087334, 1.6053754970357, 1.60870951716152, 1.61204705260132, 1.61538812459425, 1.61873275427015, 1.62208096265151,
+		1.62543277065547, 1.62878819909567, 1.63214726868419, 1.63551000003335, 1.63887641365759, 1.64224652997512, 1.64562036930989, 1.64899795189307,
+
+		// alpha = 0.25, k1 = 1
+		5.82842712474619, 2.57142857142857, 2.02386269145429, 1.80740478725882, 1.69246839667097, 1.62141846310423, 1.57321501109082, 1.53838938803095,
+		1.5120616824459, 1.49146473982619, 1.47491368977894, 1.46132446828626, 1.44996817131657, 1.44033673390415, 1.43206524264799, 1.42488486803399,
+		1.41859321162905, 1.4130349909295, 1.40808908995093, 1.40365965633945, 1.39966984334131, 1.3960573235045, 1.39277101546442, 1.38976865774637,
+		1.38701498451156, 1.38448033597752, 1.38213958732278, 1.37997131406811, 1.37795713519809, 1.37608119138532, 1.37432972698004, 1.37269075246617,
+		1.37115376987776, 1.36970954789016, 1.36834993640939, 1.36706771279938, 1.3658564536226, 1.36471042709, 1.36362450242105, 1.36259407309238,
+		1.36161499155332, 1.36068351345958, 1.35979624984352, 1.35895012593493, 1.35814234557661, 1.35737036037003, 1.35663184283034, 1.35592466295863,
+		1.3552468677331, 1.35459666310348, 1.35397239814044, 1.35337255104353, 1.35279571675911, 1.352240595997, 1.35170598546294, 1.35119076915425,
+		1.35069391058644, 1.35021444583448, 1.34975147729323, 1.34930416807077, 1.34887173694025, 1.34845345378867, 1.34804863550268, 1.34765664224814,
+		1.34727687409539, 1.34690876795641, 1.34655179480008, 1.34620545711522, 1.34586928659826, 1.34554284204008, 1.34522570739595, 1.3449174900155,
+		1.34461781902163, 1.34432634382219, 1.34404273274176, 1.3437666717626, 1.34349786336567, 1.34323602546004, 1.34298089039723, 1.3427322040573,
+		1.34248972500508, 1.34225322370942, 1.3420224818167, 1.34179729148057, 1.34157745473626, 1.34136278292015, 1.34115309613086, 1.34094822272546,
+		1.34074799885171, 1.34055226801003, 1.34036088064692, 1.34017369377298, 1.33999057060645, 1.33981138024106, 1.33963599733299, 1.33946430180905,
+		1.33929617859157, 1.33913151734278, 1.33897021222271, 1.33881216166063, 1.33865726814554, 1.33850543802129, 1.33835658130114, 1.33821061148833,
+		1.33806744540826, 1.33792700305157, 1.33778920742408, 1.3376539844065, 1.33752126262165, 1.33739097330859, 1.33726305020271, 1.33713742942704,
+		1.33701404938036, 1.33689285064193, 1.33677377587217, 1.33665676972393, 1.33654177875728, 1.3364287513565, 1.33631763765387, 1.33620838945542,
+		1.32330369693079, 1.32410469888222, 1.32490643627531, 1.32570890983751, 1.3265121202963, 1.32731606837982, 1.32812075481687, 1.32892618033694,
+		1.32973234567021, 1.3305392515475, 1.33134689870046, 1.33215528786097, 1.33296441976197, 1.33377429513785, 1.33458491472184, 1.33539627924909,
+
+		// alpha = 0.25, k1 = 2
+		7.5, 3, 2.27976314968462, 2, 1.85275281648062, 1.7622031559046, 1.70098001197932, 1.65685424949238,
+		1.6235550007847, 1.59753955386447, 1.57665693905188, 1.55952629936924, 1.54522085448528, 1.53309557943133, 1.52268777061588, 1.51365692002176,
+		1.5057468982258, 1.49876135618505, 1.49254725418585, 1.48698354997034, 1.48197325493714, 1.47743774415009, 1.47331260804855, 1.46954457971247,
+		1.46608922590276, 1.46290918925434, 1.45997283404275, 1.45725319143337, 1.45472712970842, 1.45237469541939, 1.45017858575848, 1.44812372264411,
+		1.44619690636064, 1.44438653194183, 1.44268235542861, 1.44107530006152, 1.43955729466947, 1.43812113818346, 1.43676038547831, 1.43546925072586,
+		1.43424252520428, 1.43307550710243, 1.43196394132569, 1.43090396767919, 1.42989207609965, 1.42892506784189, 1.4280000217156, 1.42711426462312,
+		1.42626534577127, 1.42545101403447, 1.42466919802842, 1.42391798852283, 1.42319562288009, 1.42250047125183, 1.42183102430583, 1.4211858822901,
+		1.42056374526612, 1.419963404368, 1.41938373396493, 1.4188236846188, 1.41828227674532, 1.41775859489714, 1.41725178259947, 1.41676103767726,
+		1.41628560801884, 1.41582478773099, 1.41537791364239, 1.41494436211992, 1.41452354616526, 1.41411491276424, 1.41371794046272, 1.41333213714637,
+		1.41295703800628, 1.41259220367119, 1.41223721849052, 1.41189168895535, 1.41155524224307, 1.41122752487611, 1.41090820148341, 1.41059695365507,
+		1.41029347888441, 1.40999748958673, 1.40970871219061, 1.40942688629518, 1.40915176388603, 1.40888310860802, 1.40862069508824, 1.40836430830523,
+		1.40811374300129, 1.40786880313475, 1.4076293013687, 1.40739505859249, 1.40716590347565, 1.40694167205005, 1.40672220731848, 1.40650735888769,
+		1.40629698262522, 1.40609094033762, 1.40588909946603, 1.4056913328033, 1.40549751822634, 1.40530753844394, 1.40512128076136, 1.40493863685618,
+		1.40475950256887, 1.40458377770478, 1.40441136584692, 1.40424217418001, 1.40407611332381, 1.4039130971747, 1.40375304275864, 1.40359587008902,
+		1.40344150203329, 1.40328986418794, 1.40314088475726, 1.40299449444171, 1.40285062632964, 1.40270921579492, 1.40257020040022, 1.40243351980635,
+		1.38629436111902, 1.38729578687937, 1.38829817729619, 1.3893015334158, 1.39030585628482, 1.39131114695115, 1.39231740646384, 1.39332463587319,
+		1.3943328362307, 1.39534200858908, 1.39635215400225, 1.39736327352516, 1.39837536821458, 1.39938843912814, 1.40040248732455, 1.40141751386343,
+
+		// alpha = 0.25, k1 = 3
+		8.19986189188807, 3.15337452881632, 2.3555512958035, 2.04666748661537, 1.88426785400688, 1.78443100276528, 1.71692882572562, 1.66827158417558,
+		1.63154632519388, 1.6028488305554, 1.57980896559363, 1.56090522024152, 1.54511637560714, 1.53173162455833, 1.52024102404406, 1.51026925933665,
+		1.50153398534877, 1.49381872932846, 1.4869547457518, 1.48080855406294, 1.47527318640959, 1.47026191807561, 1.46570369626612, 1.4615397538051,
+		1.45772106432105, 1.45420640470833, 1.450960862291, 1.44795467201579, 1.44516230159019, 1.44256172500977, 1.44013384072349, 1.4378620019236,
+		1.43573163453869, 1.4337299244036, 1.43184555942066, 1.43006851575682, 1.4283898795455, 1.42680169740079, 1.42529685045444, 1.42386894770841,
+		1.42251223533325, 1.42122151919921, 1.41999209844041, 1.41881970826274, 1.41770047052777, 1.41663085090769, 1.41560762161329, 1.41462782886755,
+		1.4136887644349, 1.41278794062744, 1.41192306830327, 1.41109203744707, 1.410292899986, 1.40952385454664, 1.40878323290162, 1.40806948789169,
+		1.40738118263895, 1.40671698089317, 1.40607563837458, 1.40545599499571, 1.40485696785862, 1.40427754494068, 1.40371677938911, 1.4031737843588,
+		1.40264772833261, 1.40213783087305, 1.40164335875964, 1.40116362247082, 1.40069797297705, 1.400245798811, 1.39980652338945, 1.39937960256018,
+		1.39896452235373, 1.39856079691934, 1.39816796662808, 1.39778559632704, 1.3974132737321, 1.39705060794469, 1.39669722808321, 1.39635278201791,
+		1.39601693520028, 1.39568936958002, 1.39536978259973, 1.39505788626338, 1.39475340627046, 1.39445608121145, 1.39416566181983, 1.39388191027434,
+		1.39360459955015, 1.39333351281276, 1.39306844285272, 1.3928091915574, 1.39255556941719, 1.39230739506389, 1.39206449483741, 1.39182670238119,
+		1.39159385826225, 1.39136580961424, 1.39114240980363, 1.39092351811395, 1.39070899945197, 1.39049872406816, 1.39029256729591, 1.39009040930472,
+		1.38989213486781, 1.38969763314349, 1.38950679746837, 1.38931952516244, 1.38913571734423, 1.38895527875801, 1.38877811760742, 1.38860414540194,
+		1.38843327680707, 1.38826542950673, 1.38810052407011, 1.38793848382664, 1.38777923474721, 1.38762270533044, 1.38746882649733, 1.38731753148803,
+		1.36944831187648, 1.37055734810766, 1.37166741714944, 1.37277852025295, 1.37389065866971, 1.37500383365258, 1.37611804645578, 1.37723329833482,
+		1.37834959054659, 1.37946692434931, 1.38058530100255, 1.38170472176717, 1.38282518790545, 1.38394670068118, 1.38506926135912, 1.38619287120541,
+
+		// alpha = 0.25, k1 = 4
+		8.58094416795341, 3.23205080756888, 2.39010880166191, 2.06417777247591, 1.89268284523322, 1.78715454923635, 1.71573803737036, 1.66421543632003,
+		1.62529779826289, 1.59486649407996, 1.57041986859713, 1.55035109761478, 1.53358111835957, 1.51935847226904, 1.5071437861091, 1.49653989935391,
+		1.48724790113187, 1.47903852299022, 1.47173297541971, 1.4651897812882, 1.45929552561514, 1.45395822699386, 1.44910250300157, 1.44466598763959,
+		1.44059663820067, 1.4368506841985, 1.43339104660922, 1.43018610624509, 1.42720873449508, 1.42443552346445, 1.421846169243, 1.41942297390885,
+		1.41715044042777, 1.41501494084139, 1.41300444272811, 1.411108282337, 1.40931697536067, 1.40762205825771, 1.4060159545215, 1.40449186143665,
+		1.40304365375241, 1.4016658013961, 1.40035329889623, 1.3991016046157, 1.39790658824046, 1.39676448524454, 1.3956718572726, 1.39462555756297,
+		1.39362270067766, 1.39266063592638, 1.39173692396961, 1.39084931616488, 1.3899957362888, 1.38917426432221, 1.38838312203089, 1.38762066011485,
+		1.38688534673071, 1.38617575721803, 1.38549056488627, 1.38482853273532, 1.3841885060021, 1.38356940543835, 1.38297022123659, 1.38239000753415,
+		1.38182787742994, 1.38128299846086, 1.38075458848789, 1.38024191195012, 1.37974427644825, 1.37926102962432, 1.37879155630881, 1.3783352759075,
+		1.37789164000609, 1.37746013017138, 1.37704025592967, 1.37663155290737, 1.37623358111751, 1.37584592337937, 1.37546818386038, 1.37509998672691,
+		1.37474097489763, 1.37439080888837, 1.37404916574063, 1.37371573802899, 1.37339023293766, 1.37307237140315, 1.37276188731617, 1.37245852677863,
+		1.37216204741112, 1.37187221770677, 1.37158881642886, 1.37131163204714, 1.37104046221153, 1.37077511325921, 1.37051539975353, 1.37026114405202,
+		1.37001217590029, 1.36976833205333, 1.36952945591708, 1.36929539721366, 1.36906601166673, 1.3688411607035, 1.36862071117693, 1.36840453510198,
+		1.36819250940797, 1.36798451570531, 1.36778044006477, 1.36758017280895, 1.36738360831703, 1.36719064483728, 1.36700118431276, 1.36681513221493,
+		1.36663239738528, 1.3664528918883, 1.36627653086874, 1.36610323241871, 1.36593291745037, 1.36576550957615, 1.36560093499369, 1.36543912237821,
+		1.3463172644439, 1.34750466193637, 1.34869308138608, 1.34988252433322, 1.35107299231759, 1.35226448687963, 1.35345700956038, 1.35465056190152,
+		1.35584514544532, 1.35704076173475, 1.3582374123133, 1.35943509872526, 1.36063382251527, 1.36183358522926, 1.36303438841314, 1.36423623361363,
+
+		// alpha = 0.25, k1 = 5
+		8.81979303504201, 3.27989441147819, 2.40949586529936, 2.07229962568647, 1.89465976739914, 1.78521248277781, 1.71105700301068, 1.65750197833306,
+		1.61701114514718, 1.58532325938462, 1.55984825295603, 1.53892137811709, 1.52142393528358, 1.5065763711011, 1.49381881160767, 1.48273876746519,
+		1.47302562536268, 1.46444102121094, 1.4567989845725, 1.44995229049031, 1.44378286676121, 1.43819491705493, 1.43310990320303, 1.42846282550103,
+		1.42419942544288, 1.42027405458158, 1.41664803149746, 1.41328836123037, 1.41016672718557, 1.4072586901843, 1.40454304663963, 1.40200131015331,
+		1.39961728970123, 1.39737674404207, 1.39526709674769, 1.3932771998001, 1.3913971363642, 1.38961805536493, 1.3879320320414, 1.38633194983965,
+		1.38481139992906, 1.38336459534817, 1.38198629735407, 1.38067175199789, 1.37941663530742, 1.37821700574404, 1.37706926283215, 1.37597011104576,
+		1.37491652818902, 1.37390573763146, 1.37293518386052, 1.37200251089807, 1.37110554319674, 1.37024226869014, 1.36941082371867, 1.36860947959321,
+		1.3678366305928, 1.36709078322065, 1.36637054656766, 1.36567462365185, 1.36500180362093, 1.36435095471887, 1.36372101793071, 1.36311100123045,
+		1.36251997436632, 1.36194706412583, 1.36139145002953, 1.36085236040942, 1.36032906883211, 1.35982089083163, 1.35932718092235, 1.35884732986219,
+		1.35838076214429, 1.3579269336935, 1.35748532974958, 1.35705546291879, 1.35663687137899, 1.35622911722439, 1.35583178493693, 1.35544447997354,
+		1.35506682745917, 1.35469847097619, 1.35433907144206, 1.35398830606834, 1.35364586739331, 1.35331146238275, 1.35298481159393, 1.35266564839627,
+		1.3523537182453, 1.35204877800564, 1.35175059531893, 1.35145894801311, 1.35117362355, 1.35089441850923, 1.35062113810427, 1.35035359572866,
+		1.35009161253187, 1.34983501701994, 1.34958364468127, 1.34933733763465, 1.34909594429897, 1.34885931908141, 1.34862732208526, 1.3483998188336,
+		1.34817668000947, 1.34795778121102, 1.34774300271938, 1.34753222928163, 1.3473253499031, 1.3471222576535, 1.34692284948193, 1.34672702604311,
+		1.34653469153157, 1.34634575352631, 1.34616012284175, 1.34597771338763, 1.34579844203668, 1.34562222849682, 1.34544899519244, 1.34527866714992,
+		1.32513595276497, 1.32638760837974, 1.32764022312793, 1.32889379903155, 1.3301483381098, 1.33140384237997, 1.33266031385751, 1.33391775455602,
+		1.33517616648729, 1.33643555166131, 1.33769591208629, 1.33895724976867, 1.34021956671341, 1.3414828649233, 1.34274714639983, 1.34401241314265,
+
+		// alpha = 0.25, k1 = 6
+		8.98325631278224, 3.31205614485297, 2.42178539320702, 2.07656825405686, 1.89447158278091, 1.78213518271104, 1.70593189125486, 1.65083881580799,
+		1.60914497301468, 1.57648745493113, 1.55021260846548, 1.52861367329637, 1.51054296866436, 1.49520024323898, 1.48201041247844, 1.47054953837153,
+		1.46049821334533, 1.45161119865251, 1.44369706721325, 1.43660420451817, 1.43021096503555, 1.42441861255103, 1.41914616701364, 1.41432658294133,
+		1.40990387444424, 1.40583092408254, 1.4020677929819, 1.39858040330301, 1.39533950071119, 1.39231982978014, 1.38949947301855, 1.38685931684411,
+		1.38438261693463, 1.38205464202473, 1.37986238010886, 1.37779429465368, 1.37584012116032, 1.37399069649236, 1.37223781497224, 1.37057410647185,
+		1.36899293267169, 1.36748829840586, 1.36605477559329, 1.36468743771836, 1.36338180319235, 1.36213378622194, 1.36093965404903, 1.35979598961793,
+		1.35869965888287, 1.35764778209641, 1.35663770852441, 1.35566699411967, 1.35473338175793, 1.35383478369964, 1.35296926599037, 1.35213503455425,
+		1.35133042276987, 1.35055388034774, 1.34980396335236, 1.34907932523436, 1.34837870875509, 1.34770093870164, 1.34704491530384, 1.34640960827498,
+		1.34579405140911, 1.34519733767436, 1.34461861475065, 1.34405708096523, 1.34351198158515, 1.34298260543088, 1.34246828177887, 1.34196837752486,
+		1.34148229458263, 1.34100946749542, 1.34054936124059, 1.34010146920899, 1.33966531134319, 1.33924043242048, 1.33882640046701, 1.3384228052923,
+		1.33802925713314, 1.33764538539733, 1.33727083749942, 1.33690527777982, 1.33654838650132, 1.33619985891584, 1.33585940439611, 1.33552674562723,
+		1.33520161785291, 1.33488376817247, 1.33457295488448, 1.33426894687371, 1.33397152303765, 1.33368047175, 1.3333955903586, 1.33311668471434,
+		1.33284356873012, 1.33257606396636, 1.33231399924227, 1.33205721027049, 1.3318055393133, 1.33155883485972, 1.33131695132099, 1.33107974874411,
+		1.33084709254172, 1.33061885323746, 1.33039490622537, 1.33017513154335, 1.32995941365849, 1.32974764126474, 1.32953970709132, 1.32933550772121,
+		1.32913494342008, 1.32893791797333, 1.32874433853265, 1.32855411546957, 1.32836716223743, 1.32818339523993, 1.32800273370648, 1.32782509957384,
+		1.30680068676343, 1.30810818869249, 1.30941654765009, 1.31072576640784, 1.31203584772916, 1.31334679437012, 1.31465860907943, 1.31597129459854,
+		1.31728485366182, 1.31859928899649, 1.31991460332277, 1.32123079935404, 1.3225478797967, 1.32386584735031, 1.32518470470792, 1.32650445455588,
+
+		// alpha = 0.25, k1 = 7
+		9.10206497286361, 3.33515915450105, 2.43022782628008, 2.07900049419889, 1.89351270254926, 1.77894740737697, 1.70114498800102, 1.64483810214269,
+		1.60218608059875, 1.56875001906676, 1.54182839087547, 1.51968258003176, 1.50114278057858, 1.48539283630647, 1.4718459019806, 1.46006913577856,
+		1.44973625304009, 1.44059661125054, 1.43245447335548, 1.42515474191594, 1.41857292397256, 1.41260793122202, 1.40717682256327, 1.40221090371809,
+		1.39765279193462, 1.39345417809629, 1.38957410020197, 1.38597759683358, 1.38263464645262, 1.37951932412901, 1.37660912539873, 1.37388441982579,
+		1.37132800612819, 1.36892474749711, 1.36666127072982, 1.3645257165128, 1.36250753098548, 1.36059729083367, 1.3587865557821, 1.35706774360415,
+		1.35543402373695, 1.35387922634765, 1.35239776429388, 1.35098456589389, 1.34963501679825, 1.34834490955694, 1.34711039971865, 1.34592796749555,
+		1.34479438418736, 1.34370668268917, 1.34266213151471, 1.34165821185576, 1.34069259727144, 1.33976313566206, 1.33886783323336, 1.33800484019909,
+		1.33717243800614, 1.33636902789615, 1.33559312064333, 1.33484332732966, 1.33411835103722, 1.33341697935283, 1.33273807759404, 1.3320805826765,
+		1.33144349755299, 1.3308258861631, 1.33022686883932, 1.32964561812247, 1.32908135494425, 1.32853334514003, 1.3280008962589, 1.32748335464212,
+		1.32698010274346, 1.32649055666888, 1.32601416391467, 1.32555040128553, 1.32509877297631, 1.32465880880248, 1.3242300625659, 1.32381211054444,
+		1.323404550094, 1.32300699835375, 1.32261909104573, 1.32224048136067, 1.32187083892318, 1.32150984882952, 1.32115721075231, 1.32081263810667,
+		1.32047585727289, 1.32014660687142, 1.31982463708589, 1.31950970903058, 1.3192015941589, 1.31890007371012, 1.3186049381909, 1.31831598688981,
+		1.31803302742176, 1.31775587530057, 1.31748435353781, 1.31721829226562, 1.31695752838202, 1.31670190521759, 1.31645127222113, 1.31620548466405,
+		1.31596440336159, 1.31572789440956, 1.31549582893667, 1.31526808286985, 1.31504453671323, 1.31482507533895, 1.31460958778926, 1.31439796708933,
+		1.31419011007042, 1.3139859172018, 1.31378529243181, 1.31358814303729, 1.31339437948042, 1.31320391527334, 1.31301666684923, 1.31283255343995,
+		1.29102107827192, 1.29237874118029, 1.29373712696632, 1.29509623947773, 1.296456082544, 1.29781665997725, 1.29917797557245, 1.30054003310759,
+		1.3019028363439, 1.30326638902601, 1.30463069488218, 1.30599575762455, 1.30736158094913, 1.308728168536, 1.31009552404994, 1.31146365114,
+
+		// alpha = 0.25, k1 = 8
+		9.19227856852497, 3.3525577117542, 2.43636625101275, 2.08046390212776, 1.89230438540024, 1.77596227551413, 1.69687168169903, 1.63957797557821,
+		1.59614063163807, 1.56206190569164, 1.53460299076346, 1.51200031937834, 1.49306665603782, 1.47697324528108, 1.46312387558483, 1.45107857784153,
+		1.44050553573528, 1.43114974020205, 1.42281195635492, 1.41533424852711, 1.40858979441084, 1.4024755745294, 1.39690703210562, 1.39181411000934,
+		1.38713826731223, 1.38283020395663, 1.37884810480096, 1.37515626971365, 1.37172403413756, 1.36852491067953, 1.36553590063652, 1.36273693744062,
+		1.36011043342872, 1.35764090821679, 1.35531468202677, 1.35311962108946, 1.35104492508488, 1.3490809487352, 1.34721905131175, 1.34545146908786,
+		1.34377120675476, 1.34217194458956, 1.34064795877079, 1.33919405271837, 1.33780549771772, 1.33647798139523, 1.33520756285926, 1.33399063352154,
+		1.33282388277692, 1.33170426785231, 1.33062898724561, 1.32959545726546, 1.32860129125723, 1.3276442811631, 1.32672238111582, 1.32583369280905,
+		1.32497645242371, 1.32414901892065, 1.32334986353582, 1.32257756033611, 1.32183077771313, 1.32110827070782, 1.32040887407291, 1.31973149599135,
+		1.31907511238007, 1.31843876171579, 1.31782154032826, 1.31722259811223, 1.31664113461539, 1.31607639546425, 1.31552766909451, 1.31499428375601,
+		1.3144756047657, 1.31397103198504, 1.31347999750066, 1.31300196348952, 1.31253642025153, 1.31208288439462, 1.31164089715859, 1.31121002286556,
+		1.31078984748591, 1.31037997730981, 1.30998003771566, 1.30958967202665, 1.30920854044889, 1.30883631908399, 1.30847269901002, 1.30811738542567,
+		1.30777009685238, 1.3074305643901, 1.3070985310221, 1.30677375096568, 1.306455989065, 1.30614502022251, 1.30584062886707, 1.30554260845495,
+		1.30525076100223, 1.30496489664571, 1.30468483323083, 1.30441039592431, 1.30414141684977, 1.30387773474526, 1.30361919464039, 1.30336564755272,
+		1.30311695020091, 1.30287296473488, 1.30263355848062, 1.30239860369958, 1.30216797736127, 1.30194156092818, 1.30171924015266, 1.30150090488437,
+		1.3012864488886, 1.30107576967321, 1.30086876832579, 1.30066534935834, 1.30046542056047, 1.30026889286003, 1.30007568019052, 1.29988569936553,
+		1.27735687128033, 1.27876053126728, 1.28016475259609, 1.28156954056557, 1.28297490044007, 1.28438083745053, 1.28578735679482, 1.28719446363827,
+		1.288602163114, 1.29001046032341, 1.29141936033653, 1.29282886819242, 1.29423898889968, 1.29564972743664, 1.29706108875195, 1.29847307776487,
+
+		// alpha = 0.25, k1 = 9
+		9.26309327508478, 3.36613218187932, 2.44102161538673, 2.08137723630083, 1.89105600283724, 1.77326172535663, 1.69310875471241, 1.63499463241687,
+		1.59089972047984, 1.55627945793325, 1.52836523782627, 1.50537345228057, 1.48610279952118, 1.46971430784681, 1.45560413596183, 1.44332648306491,
+		1.43254498743744, 1.42300103739564, 1.41449250099436, 1.40685908317375, 1.39997201849739, 1.39372667117726, 1.38803712793211, 1.38283218398325,
+		1.37805232034852, 1.37364739789285, 1.36957487723397, 1.36579842961423, 1.36228684201896, 1.35901314625003, 1.35595392023188, 1.35308872305114,
+		1.35039963476785, 1.34787087899299, 1.34548851135902, 1.34324016083184, 1.34111481368786, 1.33910263216073, 1.33719480143105, 1.33538339991905,
+		1.33366128883955, 1.33202201776057, 1.33045974352208, 1.32896916035961, 1.32754543946569, 1.32618417653381, 1.32488134608083, 1.32363326154681,
+		1.32243654033686, 1.321288073105, 1.3201849966911, 1.31912467021352, 1.31810465389634, 1.31712269027252, 1.31617668745803, 1.31526470423494,
+		1.31438493671942, 1.31353570642154, 1.31271544952994, 1.31192270727752, 1.31115611726262, 1.31041440561723, 1.30969637992695, 1.30900092282005,
+		1.30832698615296, 1.3076735857282, 1.307039796489, 1.30642474814097, 1.30582762115712, 1.30524764312788, 1.30468408542144, 1.30413626012451,
+		1.30360351723608, 1.30308524209005, 1.30258085298569, 1.30208979900595, 1.30161155800707, 1.30114563476375, 1.30069155925583, 1.3002488850845,
+		1.29981718800624, 1.29939606457479, 1.29898513088181, 1.29858402138785, 1.29819238783655, 1.29780989824472, 1.29743623596251, 1.2970710987981,
+		1.29671419820158, 1.29636525850356, 1.29602401620404, 1.29569021930836, 1.29536362670553, 1.29504400758699, 1.29473114090196, 1.29442481484704,
+		1.29412482638761, 1.29383098080842, 1.29354309129188, 1.29326097852156, 1.29298447030917, 1.292713401244, 1.29244761236259, 1.29218695083737,
+		1.29193126968372, 1.29168042748299, 1.29143428812167, 1.29119272054483, 1.29095559852315, 1.2907228004329, 1.29049420904776, 1.29026971134171,
+		1.29004919830269, 1.28983256475581, 1.28961970919603, 1.28941053362948, 1.28920494342284, 1.28900284716054, 1.28880415650913, 1.28860878608846,
+		1.2654168267186, 1.26686326213584, 1.26831007323502, 1.2697572671832, 1.27120485108875, 1.27265283200262, 1.27410121691909, 1.27555001277666,
+		1.27699922645883, 1.27844886479487, 1.27989893456066, 1.28134944247944, 1.28280039522248, 1.28425179940997, 1.28570366161162, 1.28715598834747,
+
+		// alpha = 0.25, k1 = 10
+		9.3201494404955, 3.37701838411933, 2.44466881993082, 2.08196054009373, 1.88985299641796, 1.7708482793026, 1.68980276612367, 1.63099449415782,
+		1.58633969548094, 1.55125573242434, 1.5229496715277, 1.49962148121075, 1.4800582856484, 1.46341267317115, 1.44907447429289, 1.436593032671,
+		1.42562818788154, 1.41591830661518, 1.40725881870168, 1.3994874368231, 1.39247374961633, 1.38611174809238, 1.38031436320644, 1.37500940970393,
+		1.37013653085156, 1.36564486702844, 1.36149125550893, 1.3576388252717, 1.35405588918005, 1.35071506254741, 1.34759255584327, 1.34466760264459,
+		1.34192199356612, 1.33933969392915, 1.33690652811097, 1.33460991737893, 1.33243866091731, 1.3303827519601, 1.32843322262869, 1.32658201237483,
+		1.32482185593942, 1.32314618752844, 1.32154905852998, 1.3200250665896, 1.31856929425463, 1.31717725571325, 1.31584485040844, 1.31456832251244,
+		1.31334422541524, 1.31216939051751, 1.31104089973079, 1.30995606118097, 1.30891238768754, 1.30790757765561, 1.30693949807045, 1.30600616932947,
+		1.30510575168402, 1.30423653309493, 1.30339691833278, 1.30258541917627, 1.30180064558208, 1.30104129771504, 1.30030615874306, 1.29959408831188,
+		1.2989040166263, 1.298234939073, 1.29758591132794, 1.29695604489813, 1.29634450305352, 1.29575049710951, 1.29517328302557, 1.29461215828893,
+		1.29406645905568, 1.29353555752514, 1.29301885952523, 1.29251580228953, 1.29202585240851, 1.29154850393903, 1.29108327665816, 1.29062971444864,
+		1.29018738380454, 1.28975587244654, 1.28933478803812, 1.28892375699349, 1.28852242337034, 1.28813044783999, 1.28774750672886, 1.28737329112574,
+		1.28700750604928, 1.28664986967129, 1.28630011259155, 1.28595797715981, 1.28562321684215, 1.2852955956274, 1.28497488747165, 1.28466087577735,
+		1.28435335290483, 1.28405211971373, 1.28375698513251, 1.28346776575374, 1.28318428545338, 1.28290637503302, 1.28263387188226, 1.28236661966146,
+		1.28210446800203, 1.28184727222406, 1.28159489306981, 1.28134719645189, 1.2811040532155, 1.28086533891364, 1.28063093359458, 1.28040072160034,
+		1.2801745913767, 1.27995243529227, 1.27973414946788, 1.27951963361428, 1.2793087908783, 1.2791015276971, 1.27889775365945, 1.27869738137412,
+		1.25488613968879, 1.25637275793124, 1.25785954449099, 1.25934650885808, 1.26083366042955, 1.26232100851107, 1.26380856231847, 1.26529633097918,
+		1.26678432353362, 1.26827254893666, 1.26976101605893, 1.2712497336882, 1.27273871053069, 1.27422795521231, 1.27571747628007, 1.27720728220314,
+	};
+};
@@ -1,12 +1,28 @@
 #pragma once
 #include "MainHeader.hpp"
 #include "argparse/argparse.hpp"
+#include "DataGetter/BinaryDataGetter.hpp"
+#include "DataGetter/CsvDataGetter.hpp"
 #include "DataGetter/JsonDataGetter.hpp"
 #include "FisherF/FisherF.hpp"
 
 class Main {
 private:
 	static const std::pair <const char*, const char*> FILES_ARG_STR;
+	static const std::pair <const char*, const char*> KAHAN_ARG_STR;
+	static const std::pair <const char*, const char*> THREADS_ARG_STR;
+	static const std::pair <const char*, const char*> JOBS_ARG_STR;
+	static const std::pair <const char*, const char*> CONVERT_ARG_STR;
+	static const std::pair <const char*, const char*> PROBABILITY_ARG_STR;
+	static const std::pair <const char*, const char*> X_COLUMN_ARG_STR;
+	static const std::pair <const char*, const char*> Y_COLUMN_ARG_STR;
+	static const std::pair <const char*, const char*> DELIMITER_ARG_STR;
+	static const std::pair <const char*, const char*> WINDOW_ARG_STR;
+	static const std::pair <const char*, const char*> STRIDE_ARG_STR;
+	static const std::pair <const char*, const char*> SUMMARIZE_ARG_STR;
+	static const std::pair <const char*, const char*> MERGE_ARG_STR;
+	static const std::pair <const char*, const char*> PRECISION_ARG_STR;
+	static const std::pair <const char*, const char*> ROWS_ARG_STR;
 
 public:
 	explicit Main(int argc, char* argv[]) {
@@ -27,66 +43,255 @@ public:
 			return EXIT_FAILURE;
 		}
 
+		this->CheckPrecision();
+
+		if (this->isConvert_) {
+			for (const auto& path : this->filePaths_) {
+				this->ConvertFile(path);
+			}
+		}
+		else if (this->isSummarize_) {
+			for (const auto& path : this->filePaths_) {
+				this->SummarizeFile(path);
+			}
+		}
+		else if (this->isMerge_) {
+			Main::PrintSummaryHeader(this->filePaths_.size());
+			this->ProcessSummaries(std::cout);
+		}
+		else if (this->jobs_ > 1u) {
+			this->LaunchPipeline();
+		}
+		else {
+			for (const auto& path : this->filePaths_) {
+				Main::PrintFileHeader(path);
+				this->ProcessFile(path, std::cout);
+			}
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+private:
+	std::vector<std::string> argv_;
+	std::vector<std::string> filePaths_;
+	SolverOptions solverOptions_;
+	unsigned jobs_{ 1u };
+	bool isConvert_{};
+	bool isSummarize_{};
+	bool isMerge_{};
+	CsvOptions csvOptions_;
+	std::size_t window_{};
+	std::size_t stride_{ 1u };
+	RowSelection rows_;
+
+	void InitArgv(int argc, char* argv[]) {
+		std::copy_n(argv, argc, std::back_inserter(this->argv_));
+	}
+
+	// Files are parsed and solved on a worker pool while this thread prints
+	// the finished reports strictly in input order.
+	void LaunchPipeline() const {
+		const auto threadPool = std::make_unique<ThreadPool>(this->jobs_);
+		const auto window = 2u * static_cast<std::size_t>(this->jobs_);
+
+		std::deque<std::future<std::string>> reports;
+		auto next = this->filePaths_.cbegin();
+
 		for (const auto& path : this->filePaths_) {
-			fmt::print(" : ");
-			fmt::print(fmt::fg(fmt::color::aqua), "{}\n", path);
+			for (; next != this->filePaths_.cend() && reports.size() < window; ++next) {
+				reports.push_back(threadPool->Submit([this, &nextPath = *next] {
+					std::ostringstream out;
+					this->ProcessFile(nextPath, out);
+
+					return std::move(out).str();
+				}));
+			}
+
+			Main::PrintFileHeader(path);
+
+			const auto report = reports.front().get();
+			reports.pop_front();
+
+			std::cout << report << std::flush;
+		}
+	}
+
+	void ProcessFile(const std::string& path, std::ostream& out) const {
+		const auto dataGetter = this->CreateDataGetter(path);
 
-			std::fstream file(path, std::fstream::in);
+		const auto probability = dataGetter->GetConfidenceProbability();
+		const auto design = dataGetter->GetDesignView();
+
+		if (this->window_ != 0u) {
+			this->ProcessWindows(dataGetter->GetView(), probability, out);
+			return;
+		}
 
-			if (!file.is_open()) {
-				throw std::runtime_error("Wrong path or file doesn't exist!");
+		if (design.GetColumnCount() > 1u) {
+			if (this->solverOptions_.precision != Precision::Double) {
+				throw std::runtime_error("Data with more than one regressor is solved in double precision only!");
 			}
 
-			const std::unique_ptr<IDataGetter> dataGetter
-				= std::make_unique<JsonDataGetter>(std::move(file));
+			this->ProcessMultipleRegression(design, probability, out);
+			return;
+		}
+
+		switch (this->solverOptions_.precision) {
+		case Precision::Float:
+			this->ProcessPoints<float, float>(dataGetter->GetView(), probability, out);
+			break;
+		case Precision::Mixed:
+			this->ProcessPoints<float, double>(dataGetter->GetView(), probability, out);
+			break;
+		case Precision::LongDouble:
+			this->ProcessPoints<long double, long double>(dataGetter->GetView(), probability, out);
+			break;
+		default:
+			this->ProcessPoints<double, double>(dataGetter->GetView(), probability, out);
+			break;
+		}
+	}
+
+	// Points are converted to T unless they are already doubles, the sums are accumulated in A.
+	template<class T, class A>
+	void ProcessPoints(const PointSetView<double>& data, double probability, std::ostream& out) const {
+		std::unique_ptr<MathSolver<T, A>> mathSolver;
 
-			const auto points = dataGetter->GetData();
-			const auto probability = dataGetter->GetConfidenceProbability();
+		if constexpr (std::is_same_v<T, double>) {
+			mathSolver = std::make_unique<MathSolver<T, A>>(data, this->solverOptions_);
+		}
+		else {
+			mathSolver = std::make_unique<MathSolver<T, A>>(PointSet<T>{ data }, this->solverOptions_);
+		}
 
-			const std::unique_ptr<MathSolver<double>> mathSolver{
-				new MathSolver<double>{ points.begin(), points.end() }
-			};
+		const auto table = this->CreateTable(mathSolver.get());
+		out << table << '\n';
 
-			const auto table = this->CreateTable(mathSolver.get());
-			std::cout << table << '\n';
+		Main::PrintDelimiter(out, '=', 60u);
 
-			Main::PrintDelimiter(std::cout, '=', 60u);
+		out << std::format("  x: {:.4f}\n", mathSolver->GetXExpectedValue());
+		out << std::format("  y: {:.4f}\n", mathSolver->GetYExpectedValue());
 
-			std::cout << std::format("  x: {:.4f}\n", mathSolver->GetXExpectedValue());
-			std::cout << std::format("  y: {:.4f}\n", mathSolver->GetYExpectedValue());
+		Main::PrintDelimiter(out, '=', 60u);
 
-			Main::PrintDelimiter(std::cout, '=', 60u);
+		out << std::format("F : {:.4f}\n", mathSolver->GetFStatistics());
 
-			std::cout << std::format("F : {:.4f}\n", mathSolver->GetFStatistics());
+		Main::PrintDelimiter(out, '=', 60u);
 
-			Main::PrintDelimiter(std::cout, '=', 60u);
+		Main::PrintFTest(out, mathSolver->GetFStatistics(), mathSolver->GetK(), mathSolver->GetSize(), probability);
+	}
 
-			const auto modelF = mathSolver->GetFStatistics();
-			const auto fisherF = std::make_unique<FisherF>(mathSolver->GetK(), mathSolver->GetDataX().size() - 2)
-				->GetFStatistics(1.0 - probability);
+	void ProcessMultipleRegression(const DesignMatrixView<double>& design, double probability, std::ostream& out) const {
+		const auto solver = MultipleRegressionSolver<double>{ design, this->solverOptions_ };
 
-			if (modelF < fisherF) {
-				std::cout << std::format("{:.4f} < {:.4f}", modelF, fisherF) << '\n';
-				std::cout << " " << '\n';
-			}
-			else {
-				std::cout << std::format("{:.4f} >= {:.4f}", modelF, fisherF) << '\n';
-				std::cout << " " << '\n';
-			}
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format("  (k = {}):\n", solver.GetK());
+		out << std::format("a0: {:.4f}\n", solver.GetIntercept());
 
-			Main::PrintDelimiter(std::cout, '=', 60u);
-			std::cout << std::flush;
+		const auto coefficients = solver.GetCoefficients();
+
+		for (std::size_t j = 0u; j < coefficients.size(); ++j) {
+			out << std::format("a{}: {:.4f}\n", j + 1u, coefficients[j]);
 		}
 
-		return EXIT_SUCCESS;
+		Main::PrintDelimiter(out, '=', 60u);
+
+		const auto xExpectedValues = solver.GetXExpectedValues();
+
+		for (std::size_t j = 0u; j < xExpectedValues.size(); ++j) {
+			out << std::format("  x{}: {:.4f}\n", j + 1u, xExpectedValues[j]);
+		}
+
+		out << std::format("  y: {:.4f}\n", solver.GetYExpectedValue());
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format(" : {:.4f}\n", solver.GetDeterminationCoefficient());
+		out << std::format("F : {:.4f}\n", solver.GetFStatistics());
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		Main::PrintFTest(out, solver.GetFStatistics(), solver.GetK(), solver.GetSize(), probability);
 	}
 
-private:
-	std::vector<std::string> argv_;
-	std::vector<std::string> filePaths_;
+	void ProcessWindows(const PointSetView<double>& data, double probability, std::ostream& out) const {
+		const auto solver = SlidingWindowSolver<double>{ data, this->window_, this->stride_, this->solverOptions_ };
+		const auto fisherF = FisherF(solver.GetK(), static_cast<std::int64_t>(this->window_) - solver.GetK() - 1)
+			.GetFStatistics(1.0 - probability);
 
-	void InitArgv(int argc, char* argv[]) {
-		std::copy_n(argv, argc, std::back_inserter(this->argv_));
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format(": {}, : {}, : {}\n", this->window_, this->stride_, solver.GetWindows().size());
+		out << std::format("  F: {:.4f}\n", fisherF);
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format("{:>12} {:>12} {:>12} {:>14}  {}\n", "", "a0", "a1", "F", "");
+
+		for (const auto& window : solver.GetWindows()) {
+			out << std::format("{:>12} {:>12.4f} {:>12.4f} {:>14.4f}  {}\n", window.offset, window.alphaZero, window.alphaOne,
+				window.fStatistics, window.fStatistics < fisherF ? "" : "");
+		}
+
+		Main::PrintDelimiter(out, '=', 60u);
+		out << std::flush;
+	}
+
+	// Every input is a .sum file, the merged summary is tested as one data set.
+	void ProcessSummaries(std::ostream& out) const {
+		RegressionSummary summary;
+
+		for (const auto& path : this->filePaths_) {
+			summary.Merge(RegressionSummary::Read(path));
+		}
+
+		const auto solver = OnlineMathSolver<double>{ summary.GetMoments() };
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format(" : {}\n", solver.GetSize());
+		out << std::format("a0: {:.4f}\n", solver.GetAlphaZero());
+		out << std::format("a1: {:.4f}\n", solver.GetAlphaOne());
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format("  x: {:.4f}\n", solver.GetXExpectedValue());
+		out << std::format("  y: {:.4f}\n", solver.GetYExpectedValue());
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		out << std::format(" : {:.4f}\n", solver.GetDeterminationCoefficient());
+		out << std::format("F : {:.4f}\n", solver.GetFStatistics());
+
+		Main::PrintDelimiter(out, '=', 60u);
+
+		Main::PrintFTest(out, solver.GetFStatistics(), solver.GetK(), solver.GetSize(), summary.GetConfidenceProbability());
+	}
+
+	// Compares the model against the critical value F(1 - p; k, n - k - 1).
+	static void PrintFTest(std::ostream& out, double modelF, int k, std::size_t size, double probability) {
+		const auto fisherF = FisherF(k, static_cast<std::int64_t>(size) - k - 1).GetFStatistics(1.0 - probability);
+
+		if (modelF < fisherF) {
+			out << std::format("{:.4f} < {:.4f}", modelF, fisherF) << '\n';
+			out << " " << '\n';
+		}
+		else {
+			out << std::format("{:.4f} >= {:.4f}", modelF, fisherF) << '\n';
+			out << " " << '\n';
+		}
+
+		Main::PrintDelimiter(out, '=', 60u);
+		out << std::flush;
+	}
+
+	// Windows and merged summaries have only a double solver, a file with k > 1 is checked when it is read.
+	void CheckPrecision() const {
+		if (this->solverOptions_.precision != Precision::Double && (this->window_ != 0u || this->isMerge_)) {
+			throw std::runtime_error("Windows and merged summaries are solved in double precision only!");
+		}
 	}
 
 	void ParseArgs() {
@@ -94,23 +299,142 @@ private:
 			const auto argumentParser = std::make_unique<argparse::ArgumentParser>();
 			argumentParser->add_argument(Main::FILES_ARG_STR.first, Main::FILES_ARG_STR.second)
 				.required()
-				.nargs(static_cast<int>(this->argv_.size()) - 2)
-				.help("specify the input JSON-files.");
+				.remaining()
+				.help("specify the input JSON, CSV/TSV or .pts files (must be the last argument).");
+
+			argumentParser->add_argument(Main::KAHAN_ARG_STR.first, Main::KAHAN_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("use compensated (Kahan) summation for the sums.");
+
+			argumentParser->add_argument(Main::THREADS_ARG_STR.first, Main::THREADS_ARG_STR.second)
+				.default_value(1u)
+				.scan<'u', unsigned>()
+				.help("number of threads for the sums (0 - all hardware threads).");
+
+			argumentParser->add_argument(Main::JOBS_ARG_STR.first, Main::JOBS_ARG_STR.second)
+				.default_value(1u)
+				.scan<'u', unsigned>()
+				.help("number of files processed concurrently (0 - all hardware threads).");
+
+			argumentParser->add_argument(Main::CONVERT_ARG_STR.first, Main::CONVERT_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("convert the input files to the binary .pts format instead of analyzing them.");
+
+			argumentParser->add_argument(Main::SUMMARIZE_ARG_STR.first, Main::SUMMARIZE_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("write a mergeable .sum summary of every input file instead of analyzing it.");
+
+			argumentParser->add_argument(Main::MERGE_ARG_STR.first, Main::MERGE_ARG_STR.second)
+				.default_value(false)
+				.implicit_value(true)
+				.help("merge the input .sum summaries and test them as one data set.");
+
+			argumentParser->add_argument(Main::PRECISION_ARG_STR.first, Main::PRECISION_ARG_STR.second)
+				.default_value(std::string{ "double" })
+				.help("floating point type of the solver: float, mixed (float points, double sums), double or long-double "
+					"(double only for windows, merged summaries and more than one regressor).");
+
+			argumentParser->add_argument(Main::ROWS_ARG_STR.first, Main::ROWS_ARG_STR.second)
+				.default_value(std::string{ "all" })
+				.help("rows of the point table: all, none, head:N, tail:N or sample:N (the sums are always exact).");
+
+			argumentParser->add_argument(Main::PROBABILITY_ARG_STR.first, Main::PROBABILITY_ARG_STR.second)
+				.scan<'g', double>()
+				.help("confidence probability for CSV/TSV files.");
+
+			argumentParser->add_argument(Main::X_COLUMN_ARG_STR.first, Main::X_COLUMN_ARG_STR.second)
+				.default_value(std::string{ "0" })
+				.help("name or index of the X column in CSV/TSV files.");
+
+			argumentParser->add_argument(Main::Y_COLUMN_ARG_STR.first, Main::Y_COLUMN_ARG_STR.second)
+				.default_value(std::string{ "1" })
+				.help("name or index of the Y column in CSV/TSV files.");
+
+			argumentParser->add_argument(Main::DELIMITER_ARG_STR.first, Main::DELIMITER_ARG_STR.second)
+				.help("CSV delimiter (\"tab\" for TSV), detected by the extension by default.");
+
+			argumentParser->add_argument(Main::WINDOW_ARG_STR.first, Main::WINDOW_ARG_STR.second)
+				.scan<'u', unsigned>()
+				.help("fit every window of this many consecutive points instead of the whole file.");
+
+			argumentParser->add_argument(Main::STRIDE_ARG_STR.first, Main::STRIDE_ARG_STR.second)
+				.default_value(1u)
+				.scan<'u', unsigned>()
+				.help("distance between the starts of consecutive windows.");
 
 			argumentParser->parse_args(this->argv_);
 
 			this->filePaths_ = argumentParser->get<std::vector<std::string>>(Main::FILES_ARG_STR.first);
+
+			this->solverOptions_.summation = argumentParser->get<bool>(Main::KAHAN_ARG_STR.first)
+				? Summation::Kahan
+				: Summation::Naive;
+
+			auto threads = argumentParser->get<unsigned>(Main::THREADS_ARG_STR.first);
+
+			if (threads == 0u) {
+				threads = std::max(std::thread::hardware_concurrency(), 1u);
+			}
+
+			if (threads > 1u) {
+				this->solverOptions_.threadPool = std::make_shared<ThreadPool>(threads);
+			}
+
+			this->jobs_ = argumentParser->get<unsigned>(Main::JOBS_ARG_STR.first);
+			this->isConvert_ = argumentParser->get<bool>(Main::CONVERT_ARG_STR.first);
+			this->isSummarize_ = argumentParser->get<bool>(Main::SUMMARIZE_ARG_STR.first);
+			this->isMerge_ = argumentParser->get<bool>(Main::MERGE_ARG_STR.first);
+
+			this->csvOptions_.confidenceProbability = argumentParser->present<double>(Main::PROBABILITY_ARG_STR.first);
+			this->csvOptions_.xColumn = argumentParser->get<std::string>(Main::X_COLUMN_ARG_STR.first);
+			this->csvOptions_.yColumn = argumentParser->get<std::string>(Main::Y_COLUMN_ARG_STR.first);
+
+			if (const auto delimiter = argumentParser->present<std::string>(Main::DELIMITER_ARG_STR.first)) {
+				if (delimiter->empty()) {
+					throw std::runtime_error("Empty delimiter!");
+				}
+
+				this->csvOptions_.delimiter = *delimiter == "tab" ? '\t' : delimiter->front();
+			}
+
+			const auto precision = argumentParser->get<std::string>(Main::PRECISION_ARG_STR.first);
+
+			if (precision == "float") {
+				this->solverOptions_.precision = Precision::Float;
+			}
+			else if (precision == "mixed") {
+				this->solverOptions_.precision = Precision::Mixed;
+			}
+			else if (precision == "double") {
+				this->solverOptions_.precision = Precision::Double;
+			}
+			else if (precision == "long-double") {
+				this->solverOptions_.precision = Precision::LongDouble;
+			}
+			else {
+				throw std::runtime_error("Unknown precision!");
+			}
+
+			this->rows_ = RowSelection::Parse(argumentParser->get<std::string>(Main::ROWS_ARG_STR.first));
+
+			this->window_ = argumentParser->present<unsigned>(Main::WINDOW_ARG_STR.first).value_or(0u);
+			this->stride_ = argumentParser->get<unsigned>(Main::STRIDE_ARG_STR.first);
+
+			if (this->jobs_ == 0u) {
+				this->jobs_ = std::max(std::thread::hardware_concurrency(), 1u);
+			}
 		}
 		catch (const std::exception&) {
 			throw;
 		}
 	}
 
-	template<class T>
-	[[nodiscard]] tabulate::Table CreateTable(MathSolver<T>* mathSolver) const {
-		tabulate::Table table;
-
-		table.add_row({
+	template<class T, class A>
+	[[nodiscard]] NumericTable<A> CreateTable(MathSolver<T, A>* mathSolver) const {
+		NumericTable<A> table({
 				"N", "X_i", "Y_i",
 				"X_i * Y_i", "X_i^^2",
 				"Y_i^^2", "^y_i", "^y_i - ~y",
@@ -119,40 +443,48 @@ private:
 			}
 		);
 
-		const auto x = mathSolver->GetDataX();
-		const auto y = mathSolver->GetDataY();
+		if (this->rows_.GetMode() == RowMode::All) {
+			const auto x = mathSolver->GetDataX();
+			const auto y = mathSolver->GetDataY();
 
-		const auto xxProduct = mathSolver->GetDataXXProduct();
-		const auto xyProduct = mathSolver->GetDataXYProduct();
-		const auto yyProduct = mathSolver->GetDataYYProduct();
+			table.AddIndexColumn();
+			table.AddColumn(std::vector<A>(x.begin(), x.end()));
+			table.AddColumn(std::vector<A>(y.begin(), y.end()));
 
-		const auto yCap           = mathSolver->GetDataYCap();
+			table.AddColumn(mathSolver->GetDataXYProduct());
+			table.AddColumn(mathSolver->GetDataXXProduct());
+			table.AddColumn(mathSolver->GetDataYYProduct());
 
-		const auto yCapyTildeDiff = mathSolver->GetDataYCapYTildeDiff();
-		const auto yCapyTildeDiffProduct = mathSolver->GetDataYCapYTildeDiffProduct();
+			table.AddColumn(mathSolver->GetDataYCap());
 
-		const auto yCapyDiff = mathSolver->GetDataYCapYDiff();
-		const auto yCapyDiffProduct = mathSolver->GetDataYCapYDiffProduct();
+			table.AddColumn(mathSolver->GetDataYCapYTildeDiff());
+			table.AddColumn(mathSolver->GetDataYCapYTildeDiffProduct());
 
-		const auto size = x.size();
+			table.AddColumn(mathSolver->GetDataYCapYDiff());
+			table.AddColumn(mathSolver->GetDataYCapYDiffProduct());
+		}
+		else {
+			// Only the shown rows are computed, the sums below come from the solver and cover every point.
+			const auto rows = this->rows_.GetRows(mathSolver->GetSize());
 
-		for (auto i = 0u; i < size; ++i) {
-			table.add_row({
-					std::format("{}", i + 1),
-					std::format("{:.4f}", x.at(i)),
-					std::format("{:.4f}", y.at(i)),
-					std::format("{:.4f}", xyProduct.at(i)),
-					std::format("{:.4f}", xxProduct.at(i)),
-					std::format("{:.4f}", yyProduct.at(i)),
-					std::format("{:.4f}", yCap.at(i)),
-					std::format("{:.4f}", yCapyTildeDiff.at(i)),
-					std::format("{:.4f}", yCapyTildeDiffProduct.at(i)),
-					std::format("{:.4f}", yCapyDiff.at(i)),
-					std::format("{:.4f}", yCapyDiffProduct.at(i))
-				}
-			);
+			table.AddIndexColumn(rows);
+			table.AddColumn(mathSolver->GetDataX(rows));
+			table.AddColumn(mathSolver->GetDataY(rows));
+
+			table.AddColumn(mathSolver->GetDataXYProduct(rows));
+			table.AddColumn(mathSolver->GetDataXXProduct(rows));
+			table.AddColumn(mathSolver->GetDataYYProduct(rows));
+
+			table.AddColumn(mathSolver->GetDataYCap(rows));
+
+			table.AddColumn(mathSolver->GetDataYCapYTildeDiff(rows));
+			table.AddColumn(mathSolver->GetDataYCapYTildeDiffProduct(rows));
+
+			table.AddColumn(mathSolver->GetDataYCapYDiff(rows));
+			table.AddColumn(mathSolver->GetDataYCapYDiffProduct(rows));
 		}
-		table.add_row( {
+
+		table.AddFooter({
 				std::format("sum:"),
 				std::format("{:.4f}", mathSolver->GetSumX()),
 				std::format("{:.4f}", mathSolver->GetSumY()),
@@ -177,9 +509,81 @@ private:
 		#endif
 	}
 
+	[[nodiscard]] std::unique_ptr<IDataGetter> CreateDataGetter(const std::string& path) const {
+		const auto extension = std::filesystem::path(path).extension();
+
+		if (extension == BinaryDataGetter::EXTENSION_STR) {
+			return std::make_unique<BinaryDataGetter>(path);
+		}
+
+		if (extension == CsvDataGetter::CSV_EXTENSION_STR || extension == CsvDataGetter::TSV_EXTENSION_STR) {
+			return std::make_unique<CsvDataGetter>(path, this->csvOptions_);
+		}
+
+		std::fstream file(path, std::fstream::in);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("Wrong path or file doesn't exist!");
+		}
+
+		return std::make_unique<JsonDataGetter>(std::move(file));
+	}
+
+	void ConvertFile(const std::string& path) const {
+		const auto dataGetter = this->CreateDataGetter(path);
+		const auto outputPath = std::filesystem::path(path).replace_extension(BinaryDataGetter::EXTENSION_STR).string();
+
+		if (outputPath == path) {
+			throw std::runtime_error("File is already in the binary format!");
+		}
+
+		BinaryDataGetter::Write(outputPath, dataGetter->GetView(), dataGetter->GetConfidenceProbability());
+
+		fmt::print(" : ");
+		fmt::print(fmt::fg(fmt::color::aqua), "{} -> {}\n", path, outputPath);
+	}
+
+	void SummarizeFile(const std::string& path) const {
+		const auto dataGetter = this->CreateDataGetter(path);
+		const auto outputPath = std::filesystem::path(path).replace_extension(RegressionSummary::EXTENSION_STR).string();
+
+		if (outputPath == path) {
+			throw std::runtime_error("File is already a summary!");
+		}
+
+		RegressionSummary::FromView(dataGetter->GetView(), dataGetter->GetConfidenceProbability()).Write(outputPath);
+
+		fmt::print(" : ");
+		fmt::print(fmt::fg(fmt::color::aqua), "{} -> {}\n", path, outputPath);
+	}
+
+	static void PrintFileHeader(const std::string& path) {
+		fmt::print(" : ");
+		fmt::print(fmt::fg(fmt::color::aqua), "{}\n", path);
+	}
+
+	static void PrintSummaryHeader(std::size_t count) {
+		fmt::print(" : ");
+		fmt::print(fmt::fg(fmt::color::aqua), "{}\n", count);
+	}
+
 	static void PrintDelimiter(std::ostream& out, const char symbol = '-', const size_t count = 40u) {
 		out << std::string(count, symbol) << '\n';
 	}
 };
 
 const std::pair <const char*, const char*> Main::FILES_ARG_STR = { "-f", "--files" };
+const std::pair <const char*, const char*> Main::KAHAN_ARG_STR = { "-k", "--kahan" };
+const std::pair <const char*, const char*> Main::THREADS_ARG_STR = { "-t", "--threads" };
+const std::pair <const char*, const char*> Main::JOBS_ARG_STR = { "-j", "--jobs" };
+const std::pair <const char*, const char*> Main::CONVERT_ARG_STR = { "-c", "--convert" };
+const std::pair <const char*, const char*> Main::PROBABILITY_ARG_STR = { "-p", "--probability" };
+const std::pair <const char*, const char*> Main::X_COLUMN_ARG_STR = { "-x", "--x-column" };
+const std::pair <const char*, const char*> Main::Y_COLUMN_ARG_STR = { "-y", "--y-column" };
+const std::pair <const char*, const char*> Main::DELIMITER_ARG_STR = { "-d", "--delimiter" };
+const std::pair <const char*, const char*> Main::WINDOW_ARG_STR = { "-w", "--window" };
+const std::pair <const char*, const char*> Main::STRIDE_ARG_STR = { "-s", "--stride" };
+const std::pair <const char*, const char*> Main::SUMMARIZE_ARG_STR = { "-z", "--summarize" };
+const std::pair <const char*, const char*> Main::MERGE_ARG_STR = { "-m", "--merge" };
+const std::pair <const char*, const char*> Main::PRECISION_ARG_STR = { "-P", "--precision" };
+const std::pair <const char*, const char*> Main::ROWS_ARG_STR = { "-r", "--rows" };
@@ -2,7 +2,11 @@
 
 #include <iostream>
 #include <format>
+#include <sstream>
 
+#include <deque>
+#include <filesystem>
+#include <future>
 #include <vector>
 
 #if defined(WIN32)
@@ -11,7 +15,12 @@
 
 #include <fmt/color.h>
 
-#include "tabulate/table.hpp"
+#include "Table/NumericTable.hpp"
+#include "Table/RowSelection.hpp"
 
 #include "DataGetter/TestDataGetter.hpp"
 #include "MathSolver/MathSolver.hpp"
+#include "MathSolver/MultipleRegressionSolver.hpp"
+#include "MathSolver/OnlineMathSolver.hpp"
+#include "MathSolver/RegressionSummary.hpp"
+#include "MathSolver/SlidingWindowSolver.hpp"
@@ -0,0 +1,163 @@
+#pragma once
+#include <cstddef>
+
+#include "Point/PointSet.hpp"
+
+// Count, means and co-moments about the means: sum (x - mean x)^2, sum (y - mean y)^2, sum (x - mean x)(y - mean y).
+// Points are added and removed with Welford updates and partial results are combined with the Chan et al. merge,
+// so nothing ever subtracts two large raw sums.
+template<class T>
+class CenteredMoments {
+private:
+	using value_type = T;
+
+public:
+	CenteredMoments() = default;
+
+	explicit CenteredMoments(std::size_t count, value_type xExpectedValue, value_type yExpectedValue,
+		value_type sumXX, value_type sumYY, value_type sumXY)
+		: count_(count), xExpectedValue_(xExpectedValue), yExpectedValue_(yExpectedValue),
+		  sumXX_(sumXX), sumYY_(sumYY), sumXY_(sumXY) {
+
+	}
+
+	CenteredMoments(const CenteredMoments&) = default;
+
+	CenteredMoments(CenteredMoments&&) noexcept = default;
+
+	~CenteredMoments() noexcept = default;
+
+	CenteredMoments& operator=(const CenteredMoments&) = default;
+
+	CenteredMoments& operator=(CenteredMoments&&) noexcept = default;
+
+	// Two passes over the view: the means, then the co-moments about them.
+	[[nodiscard]] static CenteredMoments FromView(const PointSetView<value_type>& view) {
+		const auto x = view.GetX();
+		const auto y = view.GetY();
+
+		if (x.empty()) {
+			return CenteredMoments{};
+		}
+
+		value_type sumX{}, sumY{};
+
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			sumX += x[i];
+			sumY += y[i];
+		}
+
+		const auto n = static_cast<value_type>(x.size());
+		const auto xExpectedValue = sumX / n;
+		const auto yExpectedValue = sumY / n;
+
+		value_type sumXX{}, sumYY{}, sumXY{};
+
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			const auto dx = x[i] - xExpectedValue;
+			const auto dy = y[i] - yExpectedValue;
+
+			sumXX += dx * dx;
+			sumYY += dy * dy;
+			sumXY += dx * dy;
+		}
+
+		return CenteredMoments{ x.size(), xExpectedValue, yExpectedValue, sumXX, sumYY, sumXY };
+	}
+
+	void Add(value_type x, value_type y) {
+		++this->count_;
+
+		const auto dx = x - this->xExpectedValue_;
+		const auto dy = y - this->yExpectedValue_;
+
+		this->xExpectedValue_ += dx / static_cast<value_type>(this->count_);
+		this->yExpectedValue_ += dy / static_cast<value_type>(this->count_);
+
+		this->sumXX_ += dx * (x - this->xExpectedValue_);
+		this->sumYY_ += dy * (y - this->yExpectedValue_);
+		this->sumXY_ += dx * (y - this->yExpectedValue_);
+	}
+
+	// Exact inverse of Add for a point that was added before.
+	void Remove(value_type x, value_type y) {
+		if (this->count_ <= 1u) {
+			*this = CenteredMoments{};
+			return;
+		}
+
+		--this->count_;
+
+		const auto xExpectedValue = this->xExpectedValue_ - (x - this->xExpectedValue_) / static_cast<value_type>(this->count_);
+		const auto yExpectedValue = this->yExpectedValue_ - (y - this->yExpectedValue_) / static_cast<value_type>(this->count_);
+
+		this->sumXX_ -= (x - xExpectedValue) * (x - this->xExpectedValue_);
+		this->sumYY_ -= (y - yExpectedValue) * (y - this->yExpectedValue_);
+		this->sumXY_ -= (x - xExpectedValue) * (y - this->yExpectedValue_);
+
+		this->xExpectedValue_ = xExpectedValue;
+		this->yExpectedValue_ = yExpectedValue;
+	}
+
+	void Merge(const CenteredMoments& other) {
+		if (other.count_ == 0u) {
+			return;
+		}
+
+		if (this->count_ == 0u) {
+			*this = other;
+			return;
+		}
+
+		const auto n = static_cast<value_type>(this->count_ + other.count_);
+		const auto weight = static_cast<value_type>(this->count_) * static_cast<value_type>(other.count_) / n;
+
+		const auto dx = other.xExpectedValue_ - this->xExpectedValue_;
+		const auto dy = other.yExpectedValue_ - this->yExpectedValue_;
+
+		this->sumXX_ += other.sumXX_ + dx * dx * weight;
+		this->sumYY_ += other.sumYY_ + dy * dy * weight;
+		this->sumXY_ += other.sumXY_ + dx * dy * weight;
+
+		this->xExpectedValue_ += dx * static_cast<value_type>(other.count_) / n;
+		this->yExpectedValue_ += dy * static_cast<value_type>(other.count_) / n;
+
+		this->count_ += other.count_;
+	}
+
+	//-------------------- GETTERS ---------------------------------------//
+
+	[[nodiscard]] std::size_t GetCount() const {
+		return this->count_;
+	}
+
+	[[nodiscard]] value_type GetXExpectedValue() const {
+		return this->xExpectedValue_;
+	}
+
+	[[nodiscard]] value_type GetYExpectedValue() const {
+		return this->yExpectedValue_;
+	}
+
+	[[nodiscard]] value_type GetSumXX() const {
+		return this->sumXX_;
+	}
+
+	[[nodiscard]] value_type GetSumYY() const {
+		return this->sumYY_;
+	}
+
+	[[nodiscard]] value_type GetSumXY() const {
+		return this->sumXY_;
+	}
+
+private:
+	std::size_t count_{};
+
+	value_type xExpectedValue_{};
+	value_type yExpectedValue_{};
+
+	value_type sumXX_{};
+	value_type sumYY_{};
+	value_type sumXY_{};
+};
@@ -0,0 +1,42 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+
+// A fitted model y = f(x): single predictions and a batch over a span of x.
+template<class M, class T>
+concept RegressionModel = requires(const M& model, T x, std::span<const T> xs, std::span<T> out) {
+	{ model(x) } -> std::convertible_to<T>;
+	model.Predict(xs, out);
+};
+
+// y = a1 * x + a0 with plain coefficients, so every call inlines and the batch loop vectorizes.
+template<class T> requires std::is_arithmetic_v<T>
+struct LinearModel {
+	using value_type = T;
+
+	value_type alphaOne{};
+	value_type alphaZero{};
+
+	[[nodiscard]] value_type operator()(value_type x) const {
+		return this->alphaOne * x + this->alphaZero;
+	}
+
+	// U may be narrower than T (float points scored with a double model).
+	template<class U>
+	void Predict(std::span<const U> x, std::span<value_type> out) const {
+		if (x.size() != out.size()) {
+			throw std::runtime_error("Output size doesn't match the input size!");
+		}
+
+		const auto alphaOne = this->alphaOne;
+		const auto alphaZero = this->alphaZero;
+
+		for (std::size_t i = 0u; i < x.size(); ++i) {
+			out[i] = alphaOne * static_cast<value_type>(x[i]) + alphaZero;
+		}
+	}
+};
+
+static_assert(RegressionModel<LinearModel<double>, double>);
@@ -1,155 +1,237 @@
 #pragma once
 #include <algorithm>
-#include <functional>
+#include <cmath>
 #include <numeric>
+#include <span>
 #include <vector>
 
-#include "Point/Point.hpp"
+#include "CenteredMoments.hpp"
+#include "LinearModel.hpp"
+#include "MomentAccumulator.hpp"
+#include "MomentKernels.hpp"
+#include "SolverOptions.hpp"
+#include "Point/PointSet.hpp"
 
-template<class T> requires
+// T is the type of the stored points, A the type of every sum and of the model.
+// MathSolver<float, double> halves the memory traffic and keeps double accumulators.
+template<class T, class A = T> requires
 	std::is_arithmetic_v<T> &&
 	(!std::is_same_v<T, bool>) &&
 	(!std::is_same_v<T, char>) &&
-	(!std::is_same_v<T, unsigned char>)
+	(!std::is_same_v<T, unsigned char>) &&
+	(std::is_same_v<T, A> || std::is_floating_point_v<A>)
 class MathSolver final {
 private:
 	using value_type = T;
+	using accumulator_type = A;
+
+	static constexpr std::size_t CHUNK_SIZE = 1u << 16u;
 
 public:
+	struct Statistics {
+		MomentAccumulator<accumulator_type> moments;
+		CenteredMoments<accumulator_type> centeredMoments;
+		ResidualAccumulator<accumulator_type> residuals;
+
+		accumulator_type xExpectedValue{};
+		accumulator_type yExpectedValue{};
+
+		accumulator_type alphaOne{};
+		accumulator_type alphaZero{};
+	};
+
 	template<class Iter>
 	explicit MathSolver(Iter begin, Iter end)
-		: data_(std::distance(begin, end)), xyProductVector_(this->data_.capacity()),
-	      xxProductVector_(this->data_.capacity()), yyProductVector_(this->data_.capacity()),
-	      yCapVector_(this->data_.capacity()), yCapyTildeDiffVector_(this->data_.capacity()),
-	      yCapyTildeDiffProductVector_(this->data_.capacity()), yCapyDiffVector_(this->data_.capacity()),
-	      yCapyDiffProductVector_(this->data_.capacity()) {
-		this->FillData(begin, end);
+		: MathSolver(PointSet<value_type>(begin, end)) {
 
-		this->CalculateProductXY();
-		this->CalculateProductXX();
-		this->CalculateProductYY();
+	}
 
-		this->BuildModel();
+	explicit MathSolver(PointSet<value_type> data, const SolverOptions& options = {})
+		: storage_(std::move(data)), data_(this->storage_.GetView()), options_(options) {
+		this->Solve();
+	}
 
-		this->CalculateCapY();
-		this->CalculateCapYTildeYDiff();
-		this->CalculateCapYTildeYDiffProduct();
-		this->CalculateCapYYDiff();
-		this->CalculateCapYYDiffProduct();
+	explicit MathSolver(PointSetView<value_type> data, const SolverOptions& options = {})
+		: data_(data), options_(options) {
+		this->Solve();
 	}
 
+	MathSolver(const MathSolver&) = delete;
+
+	MathSolver(MathSolver&&) noexcept = default;
+
+	~MathSolver() noexcept = default;
+
+	MathSolver& operator=(const MathSolver&) = delete;
+
+	MathSolver& operator=(MathSolver&&) noexcept = default;
+
 	//-------------------- VECTORS' GETTERS -----------------------------------//
 
-	[[nodiscard]] std::vector<value_type> GetDataX() const {
-		std::vector<value_type> result(this->data_.size());
+	[[nodiscard]] std::span<const value_type> GetDataX() const {
+		return this->data_.GetX();
+	}
 
-		std::for_each(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, &result](const Point<value_type>& point) mutable  {
-			result[i++] = point.x();
-		}
-		);
+	[[nodiscard]] std::span<const value_type> GetDataY() const {
+		return this->data_.GetY();
+	}
 
-		return result;
+	[[nodiscard]] std::vector<accumulator_type> GetDataXXProduct() const {
+		return this->Transform(this->GetXXProductFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataY() const {
-		std::vector<value_type> result(this->data_.size());
+	[[nodiscard]] std::vector<accumulator_type> GetDataXYProduct() const {
+		return this->Transform(this->GetXYProductFunc());
+	}
 
-		std::for_each(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, &result](const Point<value_type>& point) mutable  {
-			result[i++] = point.y();
-		}
-		);
+	[[nodiscard]] std::vector<accumulator_type> GetDataYYProduct() const {
+		return this->Transform(this->GetYYProductFunc());
+	}
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCap() const {
+		std::vector<accumulator_type> result(this->data_.GetSize());
+
+		this->Predict(this->data_.GetX(), result);
 
 		return result;
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataXXProduct() const {
-		return this->xxProductVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYTildeDiff() const {
+		return this->Transform(this->GetYCapYTildeDiffFunc());
+	}
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYTildeDiffProduct() const {
+		return this->Transform(this->GetYCapYTildeDiffProductFunc());
+	}
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYDiff() const {
+		return this->Transform(this->GetYCapYDiffFunc());
+	}
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYDiffProduct() const {
+		return this->Transform(this->GetYCapYDiffProductFunc());
+	}
+
+	//-------------------- ROWS' GETTERS --------------------------------------//
+
+	// The same values for the given row indices only, so a partial table costs O(rows.size()).
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataX(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, [](accumulator_type x, accumulator_type) {
+			return x;
+		});
+	}
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataY(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, [](accumulator_type, accumulator_type y) {
+			return y;
+		});
+	}
+
+	[[nodiscard]] std::vector<accumulator_type> GetDataXXProduct(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetXXProductFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataXYProduct() const {
-		return this->xyProductVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataXYProduct(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetXYProductFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataYYProduct() const {
-		return this->yyProductVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYYProduct(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetYYProductFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataYCap() const {
-		return this->yCapVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCap(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, [model = this->model_](accumulator_type x, accumulator_type) {
+			return model(x);
+		});
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataYCapYTildeDiff() const {
-		return this->yCapyTildeDiffVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYTildeDiff(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetYCapYTildeDiffFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataYCapYTildeDiffProduct() const {
-		return this->yCapyTildeDiffProductVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYTildeDiffProduct(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetYCapYTildeDiffProductFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataYCapYDiff() const {
-		return this->yCapyDiffVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYDiff(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetYCapYDiffFunc());
 	}
 
-	[[nodiscard]] std::vector<value_type> GetDataYCapYDiffProduct() const {
-		return this->yCapyDiffProductVector_;
+	[[nodiscard]] std::vector<accumulator_type> GetDataYCapYDiffProduct(std::span<const std::size_t> rows) const {
+		return this->Transform(rows, this->GetYCapYDiffProductFunc());
 	}
 
 	//-------------------- SUMS' GETTERS -------------------------------------//
 
-	[[nodiscard]] value_type GetSumX() const {
-		const auto xVector = this->GetDataX();
-		return this->ReduceSum(xVector.cbegin(), xVector.cend());
+	[[nodiscard]] accumulator_type GetSumX() const {
+		return this->statistics_.moments.GetSumX();
 	}
 
-	[[nodiscard]] value_type GetSumY() const {
-		const auto yVector = this->GetDataY();
-		return this->ReduceSum(yVector.cbegin(), yVector.cend());
+	[[nodiscard]] accumulator_type GetSumY() const {
+		return this->statistics_.moments.GetSumY();
 	}
 
-	[[nodiscard]] value_type GetSumXXProduct() const {
-		return this->ReduceSum(this->xxProductVector_.cbegin(), this->xxProductVector_.cend());
+	[[nodiscard]] accumulator_type GetSumXXProduct() const {
+		return this->statistics_.moments.GetSumXXProduct();
 	}
 
-	[[nodiscard]] value_type GetSumXYProduct() const {
-		return this->ReduceSum(this->xyProductVector_.cbegin(), this->xyProductVector_.cend());
+	[[nodiscard]] accumulator_type GetSumXYProduct() const {
+		return this->statistics_.moments.GetSumXYProduct();
 	}
 
-	[[nodiscard]] value_type GetSumYYProduct() const {
-		return this->ReduceSum(this->yyProductVector_.cbegin(), this->yyProductVector_.cend());
+	[[nodiscard]] accumulator_type GetSumYYProduct() const {
+		return this->statistics_.moments.GetSumYYProduct();
 	}
 
-	[[nodiscard]] value_type GetSumCapY() const {
-		return this->ReduceSum(this->yCapVector_.cbegin(), this->yCapVector_.cend());
+	[[nodiscard]] accumulator_type GetSumCapY() const {
+		return this->statistics_.residuals.GetSumCapY();
 	}
 
-	[[nodiscard]] value_type GetSumCapYTildeYDiff() const {
-		return this->ReduceSum(this->yCapyTildeDiffVector_.cbegin(), this->yCapyTildeDiffVector_.cend());
+	[[nodiscard]] accumulator_type GetSumCapYTildeYDiff() const {
+		return this->statistics_.residuals.GetSumCapYTildeYDiff();
 	}
 
-	[[nodiscard]] value_type GetSumCapYTildeYDiffProduct() const {
-		return this->ReduceSum(this->yCapyTildeDiffProductVector_.cbegin(), this->yCapyTildeDiffProductVector_.cend());
+	[[nodiscard]] accumulator_type GetSumCapYTildeYDiffProduct() const {
+		return this->statistics_.residuals.GetSumCapYTildeYDiffProduct();
 	}
 
-	[[nodiscard]] value_type GetSumCapYYDiff() const {
-		return this->ReduceSum(this->yCapyDiffVector_.cbegin(), this->yCapyDiffVector_.cend());
+	[[nodiscard]] accumulator_type GetSumCapYYDiff() const {
+		return this->statistics_.residuals.GetSumCapYYDiff();
 	}
 
-	[[nodiscard]] value_type GetSumCapYYDiffProduct() const {
-		return this->ReduceSum(this->yCapyDiffProductVector_.cbegin(), this->yCapyDiffProductVector_.cend());
+	[[nodiscard]] accumulator_type GetSumCapYYDiffProduct() const {
+		return this->statistics_.residuals.GetSumCapYYDiffProduct();
 	}
 
 	//-------------------- ANOTHER GETTERS -------------------------------------//
 
-	[[nodiscard]] value_type GetXExpectedValue() const {
-		auto x = this->GetDataX();
-		return this->ReduceSum(x.cbegin(), x.cend()) / x.size();
+	[[nodiscard]] accumulator_type GetXExpectedValue() const {
+		return this->statistics_.xExpectedValue;
+	}
+
+	[[nodiscard]] accumulator_type GetYExpectedValue() const {
+		return this->statistics_.yExpectedValue;
+	}
+
+	[[nodiscard]] accumulator_type GetAlphaOne() const {
+		return this->statistics_.alphaOne;
+	}
+
+	[[nodiscard]] accumulator_type GetAlphaZero() const {
+		return this->statistics_.alphaZero;
+	}
+
+	[[nodiscard]] const LinearModel<accumulator_type>& GetModel() const {
+		return this->model_;
 	}
 
-	[[nodiscard]] value_type GetYExpectedValue() const {
-		auto y = this->GetDataY();
-		return this->ReduceSum(y.cbegin(), y.cend()) / y.size();
+	[[nodiscard]] const Statistics& GetStatistics() const {
+		return this->statistics_;
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->data_.GetSize();
 	}
 
 	//---------------------- MATH -----------------------------------------//
@@ -158,126 +240,224 @@ public:
 		return 1;
 	}
 
-	[[nodiscard]] value_type GetFStatistics() const {
+	[[nodiscard]] accumulator_type GetFStatistics() const {
 		const auto k = this->GetK();
 
-		const auto chisl = this->GetSumCapYTildeYDiffProduct() * (this->data_.size() - 2);
+		const auto chisl = this->GetSumCapYTildeYDiffProduct() * static_cast<accumulator_type>(this->data_.GetSize() - k - 1);
 		const auto zname = this->GetSumCapYYDiffProduct() * k;
 
 		return chisl / zname;
 	}
 
+	// Scores new points with the fitted model, out must have the size of x.
+	void Predict(std::span<const value_type> x, std::span<accumulator_type> out) const {
+		this->model_.Predict(x, out);
+	}
+
 private:
-	std::vector<Point<value_type>> data_;
+	PointSet<value_type> storage_;
+	PointSetView<value_type> data_;
 
-	std::vector<value_type> xyProductVector_;
-	std::vector<value_type> xxProductVector_;
-	std::vector<value_type> yyProductVector_;
+	SolverOptions options_;
 
-	std::vector<value_type> yCapVector_;
-	std::vector<value_type> yCapyTildeDiffVector_;
-	std::vector<value_type> yCapyTildeDiffProductVector_;
-	std::vector<value_type> yCapyDiffVector_;
-	std::vector<value_type> yCapyDiffProductVector_;
+	Statistics statistics_;
 
-	std::function<value_type(value_type)> model_;
+	LinearModel<accumulator_type> model_;
 
-	template<class Iter>
-	void FillData(Iter begin, Iter end) {
-		this->ForEach(begin, end,
-			[i = 0, this](const Point<value_type>& point) mutable  {
-				this->data_[i++] = point;
-			}
-		);
+	void Solve() {
+		this->AccumulateMoments();
+
+		this->BuildModel();
+
+		this->AccumulateResiduals();
 	}
 
-	void CalculateProductXY() {
-		this->ForEach(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, this](const Point<value_type>& point) mutable  {
-				this->xyProductVector_[i++] = point.x() * point.y();
+	// The raw sums feed the table, the model is built from the centered moments: every chunk is swept again
+	// about its own means while it is still in cache, and the chunks are combined with the Chan et al. merge.
+	// Chunk means are kept relative to the first point, so large offsets (timestamps) cancel exactly.
+	void AccumulateMoments() {
+		std::vector<MomentAccumulator<accumulator_type>> chunks(this->GetChunkCount());
+		std::vector<CenteredMoments<accumulator_type>> centeredChunks(chunks.size());
+
+		const auto xOrigin = this->data_.IsEmpty() ? accumulator_type{} : static_cast<accumulator_type>(this->data_.GetX().front());
+		const auto yOrigin = this->data_.IsEmpty() ? accumulator_type{} : static_cast<accumulator_type>(this->data_.GetY().front());
+
+		this->ForEachChunk(chunks.size(),
+			[this, &chunks, &centeredChunks, xOrigin, yOrigin](std::size_t chunk, PointSetView<value_type> view) {
+				chunks[chunk] = MomentKernels::AccumulateMoments<value_type, accumulator_type>(view.GetX(), view.GetY(),
+					this->options_.summation);
+
+				if constexpr (std::is_floating_point_v<accumulator_type>) {
+					centeredChunks[chunk] = MomentKernels::AccumulateCenteredMoments<value_type, accumulator_type>(
+						view.GetX(), view.GetY(), chunks[chunk].GetXExpectedValue(), chunks[chunk].GetYExpectedValue(), xOrigin, yOrigin,
+						this->options_.summation);
+				}
 			}
 		);
+
+		CenteredMoments<accumulator_type> centeredMoments;
+
+		for (std::size_t chunk = 0u; chunk < chunks.size(); ++chunk) {
+			this->statistics_.moments.Merge(chunks[chunk]);
+			centeredMoments.Merge(centeredChunks[chunk]);
+		}
+
+		if constexpr (std::is_floating_point_v<accumulator_type>) {
+			this->statistics_.centeredMoments = CenteredMoments<accumulator_type>{
+				centeredMoments.GetCount(),
+				xOrigin + centeredMoments.GetXExpectedValue(),
+				yOrigin + centeredMoments.GetYExpectedValue(),
+				centeredMoments.GetSumXX(), centeredMoments.GetSumYY(), centeredMoments.GetSumXY()
+			};
+
+			this->statistics_.xExpectedValue = this->statistics_.centeredMoments.GetXExpectedValue();
+			this->statistics_.yExpectedValue = this->statistics_.centeredMoments.GetYExpectedValue();
+		}
+		else {
+			this->statistics_.xExpectedValue = this->statistics_.moments.GetXExpectedValue();
+			this->statistics_.yExpectedValue = this->statistics_.moments.GetYExpectedValue();
+		}
 	}
 
-	void CalculateProductXX() {
-		this->ForEach(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, this](const Point<value_type>& point) mutable  {
-				this->xxProductVector_[i++] = point.x() * point.x();
-			}
-		);
+	void BuildModel() {
+		accumulator_type alphaOne{}, alphaZero{};
+
+		if constexpr (std::is_floating_point_v<accumulator_type>) {
+			const auto& centeredMoments = this->statistics_.centeredMoments;
+
+			alphaOne = centeredMoments.GetSumXY() / centeredMoments.GetSumXX();
+			alphaZero = this->statistics_.yExpectedValue - alphaOne * this->statistics_.xExpectedValue;
+		}
+		else {
+			// Integral sums are exact, the textbook formula loses nothing here.
+			const auto n = static_cast<accumulator_type>(this->data_.GetSize());
+
+			const auto sumX = this->GetSumX();
+			const auto sumY = this->GetSumY();
+
+			alphaOne = (n * this->GetSumXYProduct() - sumX * sumY) / (n * this->GetSumXXProduct() - sumX * sumX);
+			alphaZero = (sumY - alphaOne * sumX) / n;
+		}
+
+		this->statistics_.alphaOne = alphaOne;
+		this->statistics_.alphaZero = alphaZero;
+
+		this->model_ = LinearModel<accumulator_type>{ alphaOne, alphaZero };
 	}
 
-	void CalculateProductYY() {
-		this->ForEach(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, this](const Point<value_type>& point) mutable  {
-				this->yyProductVector_[i++] = point.y() * point.y();
+	void AccumulateResiduals() {
+		const auto alphaOne = this->statistics_.alphaOne;
+		const auto alphaZero = this->statistics_.alphaZero;
+		const auto yExpectedValue = this->statistics_.yExpectedValue;
+
+		std::vector<ResidualAccumulator<accumulator_type>> chunks(this->GetChunkCount());
+
+		this->ForEachChunk(chunks.size(),
+			[this, &chunks, alphaOne, alphaZero, yExpectedValue](std::size_t chunk, PointSetView<value_type> view) {
+				chunks[chunk] = MomentKernels::AccumulateResiduals<value_type, accumulator_type>(view.GetX(), view.GetY(),
+					alphaOne, alphaZero, yExpectedValue, this->options_.summation);
 			}
 		);
+
+		this->statistics_.residuals = ResidualAccumulator<accumulator_type>{ alphaOne, alphaZero, yExpectedValue };
+
+		for (const auto& chunk : chunks) {
+			this->statistics_.residuals.Merge(chunk);
+		}
 	}
 
-	void BuildModel() {
-		auto alphaOne = this->data_.size() * this->GetSumXYProduct() - this->GetSumX() * this->GetSumY();
-		alphaOne /= this->data_.size() * this->GetSumXXProduct() - std::pow(this->GetSumX(), 2.0);
+	// Chunk boundaries depend only on the input size, so the merged sums
+	// are the same for any number of threads.
+	[[nodiscard]] std::size_t GetChunkCount() const {
+		return (this->data_.GetSize() + MathSolver::CHUNK_SIZE - 1u) / MathSolver::CHUNK_SIZE;
+	}
 
-		auto alphaZero = (this->GetSumY() - alphaOne * this->GetSumX()) / this->data_.size();
+	template<class Func>
+	void ForEachChunk(std::size_t chunkCount, Func func) const {
+		const auto body = [this, &func](std::size_t chunk) {
+			const auto offset = chunk * MathSolver::CHUNK_SIZE;
+			const auto count = std::min(MathSolver::CHUNK_SIZE, this->data_.GetSize() - offset);
 
-		this->model_ = [alphaOne, alphaZero](value_type x) {
-			return alphaOne * x + alphaZero;
+			func(chunk, this->data_.GetSubView(offset, count));
 		};
+
+		if (this->options_.threadPool && chunkCount > 1u) {
+			this->options_.threadPool->ParallelFor(chunkCount, body);
+			return;
+		}
+
+		for (std::size_t chunk = 0u; chunk < chunkCount; ++chunk) {
+			body(chunk);
+		}
 	}
 
-	void CalculateCapY() {
-		this->ForEach(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, this](const Point<value_type>& point) mutable {
-				this->yCapVector_[i++] = this->model_(point.x());
-			}
-		);
+	template<class Func>
+	[[nodiscard]] std::vector<accumulator_type> Transform(Func func) const {
+		const auto x = this->data_.GetX();
+		const auto y = this->data_.GetY();
+
+		std::vector<accumulator_type> result(x.size());
+
+		std::transform(x.begin(), x.end(), y.begin(), result.begin(), func);
+
+		return result;
 	}
 
-	void CalculateCapYTildeYDiff() {
-		this->ForEach(this->yCapVector_.cbegin(), this->yCapVector_.cend(),
-			[i = 0, this](const double y) mutable {
-				this->yCapyTildeDiffVector_[i++] = y - this->GetYExpectedValue();
-			}
-		);
+	template<class Func>
+	[[nodiscard]] std::vector<accumulator_type> Transform(std::span<const std::size_t> rows, Func func) const {
+		const auto x = this->data_.GetX();
+		const auto y = this->data_.GetY();
+
+		std::vector<accumulator_type> result(rows.size());
+
+		std::transform(rows.begin(), rows.end(), result.begin(), [&x, &y, &func](std::size_t i) {
+			return func(static_cast<accumulator_type>(x[i]), static_cast<accumulator_type>(y[i]));
+		});
+
+		return result;
 	}
 
-	void CalculateCapYTildeYDiffProduct() {
-		this->ForEach(this->yCapyTildeDiffVector_.cbegin(), this->yCapyTildeDiffVector_.cend(),
-			[i = 0, this](const double y) mutable {
-				this->yCapyTildeDiffProductVector_[i++] = std::pow(y, 2.0);
-			}
-		);
+	[[nodiscard]] auto GetXXProductFunc() const {
+		return [](accumulator_type x, accumulator_type) {
+			return x * x;
+		};
 	}
 
-	void CalculateCapYYDiff() {
-		this->ForEach(this->data_.cbegin(), this->data_.cend(),
-			[i = 0, this](const Point<value_type>& point) mutable {
-				this->yCapyDiffVector_[i] = this->yCapVector_[i] - point.y();
-				++i;
-			}
-		);
+	[[nodiscard]] auto GetXYProductFunc() const {
+		return [](accumulator_type x, accumulator_type y) {
+			return x * y;
+		};
 	}
 
-	void CalculateCapYYDiffProduct() {
-		this->ForEach(this->yCapyDiffVector_.cbegin(), this->yCapyDiffVector_.cend(),
-			[i = 0, this](const double y) mutable {
-				this->yCapyDiffProductVector_[i++] = std::pow(y, 2.0);
-			}
-		);
+	[[nodiscard]] auto GetYYProductFunc() const {
+		return [](accumulator_type, accumulator_type y) {
+			return y * y;
+		};
 	}
 
-	template<class Iter, class Func>
-	void ForEach(Iter begin, Iter end, Func func) {
-		if (this->data_.empty()) {
-			return;
-		}
+	[[nodiscard]] auto GetYCapYTildeDiffFunc() const {
+		return [model = this->model_, yTilde = this->statistics_.yExpectedValue](accumulator_type x, accumulator_type) {
+			return model(x) - yTilde;
+		};
+	}
 
-		std::for_each(begin, end, func);
+	[[nodiscard]] auto GetYCapYTildeDiffProductFunc() const {
+		return [model = this->model_, yTilde = this->statistics_.yExpectedValue](accumulator_type x, accumulator_type) {
+			const auto diff = model(x) - yTilde;
+			return diff * diff;
+		};
 	}
 
-	template<class Iter>
-	[[nodiscard]] value_type ReduceSum(Iter begin, Iter end) const {
-		return std::reduce(begin, end, value_type{ 0.0 }, std::plus());
+	[[nodiscard]] auto GetYCapYDiffFunc() const {
+		return [model = this->model_](accumulator_type x, accumulator_type y) {
+			return model(x) - y;
+		};
+	}
+
+	[[nodiscard]] auto GetYCapYDiffProductFunc() const {
+		return [model = this->model_](accumulator_type x, accumulator_type y) {
+			const auto diff = model(x) - y;
+			return diff * diff;
+		};
 	}
 };
@@ -0,0 +1,168 @@
+#pragma once
+#include <cstddef>
+
+// Raw sums of x, y and their products, as printed in the table.
+// The model is built from CenteredMoments, these sums would cancel for data far from the origin.
+template<class T>
+class MomentAccumulator {
+private:
+	using value_type = T;
+
+public:
+	MomentAccumulator() = default;
+
+	explicit MomentAccumulator(std::size_t count, value_type sumX, value_type sumY,
+		value_type sumXY, value_type sumXX, value_type sumYY)
+		: count_(count), sumX_(sumX), sumY_(sumY), sumXY_(sumXY), sumXX_(sumXX), sumYY_(sumYY) {
+
+	}
+
+	MomentAccumulator(const MomentAccumulator&) = default;
+
+	MomentAccumulator(MomentAccumulator&&) noexcept = default;
+
+	~MomentAccumulator() noexcept = default;
+
+	MomentAccumulator& operator=(const MomentAccumulator&) = default;
+
+	MomentAccumulator& operator=(MomentAccumulator&&) noexcept = default;
+
+	void Add(value_type x, value_type y) {
+		++this->count_;
+
+		this->sumX_  += x;
+		this->sumY_  += y;
+		this->sumXY_ += x * y;
+		this->sumXX_ += x * x;
+		this->sumYY_ += y * y;
+	}
+
+	void Merge(const MomentAccumulator& other) {
+		this->count_ += other.count_;
+
+		this->sumX_  += other.sumX_;
+		this->sumY_  += other.sumY_;
+		this->sumXY_ += other.sumXY_;
+		this->sumXX_ += other.sumXX_;
+		this->sumYY_ += other.sumYY_;
+	}
+
+	//-------------------- SUMS' GETTERS -------------------------------------//
+
+	[[nodiscard]] std::size_t GetCount() const {
+		return this->count_;
+	}
+
+	[[nodiscard]] value_type GetSumX() const {
+		return this->sumX_;
+	}
+
+	[[nodiscard]] value_type GetSumY() const {
+		return this->sumY_;
+	}
+
+	[[nodiscard]] value_type GetSumXYProduct() const {
+		return this->sumXY_;
+	}
+
+	[[nodiscard]] value_type GetSumXXProduct() const {
+		return this->sumXX_;
+	}
+
+	[[nodiscard]] value_type GetSumYYProduct() const {
+		return this->sumYY_;
+	}
+
+	//-------------------- ANOTHER GETTERS -------------------------------------//
+
+	[[nodiscard]] value_type GetXExpectedValue() const {
+		return this->sumX_ / static_cast<value_type>(this->count_);
+	}
+
+	[[nodiscard]] value_type GetYExpectedValue() const {
+		return this->sumY_ / static_cast<value_type>(this->count_);
+	}
+
+private:
+	std::size_t count_{};
+
+	value_type sumX_{};
+	value_type sumY_{};
+	value_type sumXY_{};
+	value_type sumXX_{};
+	value_type sumYY_{};
+};
+
+template<class T>
+class ResidualAccumulator {
+private:
+	using value_type = T;
+
+public:
+	ResidualAccumulator() = default;
+
+	explicit ResidualAccumulator(value_type alphaOne, value_type alphaZero, value_type yExpectedValue)
+		: alphaOne_(alphaOne), alphaZero_(alphaZero), yExpectedValue_(yExpectedValue) {
+
+	}
+
+	explicit ResidualAccumulator(value_type alphaOne, value_type alphaZero, value_type yExpectedValue,
+		value_type sumCapY, value_type sumCapYTildeYDiff, value_type sumCapYTildeYDiffProduct,
+		value_type sumCapYYDiff, value_type sumCapYYDiffProduct)
+		: alphaOne_(alphaOne), alphaZero_(alphaZero), yExpectedValue_(yExpectedValue),
+		  sumCapY_(sumCapY), sumCapYTildeYDiff_(sumCapYTildeYDiff), sumCapYTildeYDiffProduct_(sumCapYTildeYDiffProduct),
+		  sumCapYYDiff_(sumCapYYDiff), sumCapYYDiffProduct_(sumCapYYDiffProduct) {
+
+	}
+
+	void Add(value_type x, value_type y) {
+		const auto yCap = this->alphaOne_ * x + this->alphaZero_;
+		const auto yCapyTildeDiff = yCap - this->yExpectedValue_;
+		const auto yCapyDiff = yCap - y;
+
+		this->sumCapY_ += yCap;
+		this->sumCapYTildeYDiff_ += yCapyTildeDiff;
+		this->sumCapYTildeYDiffProduct_ += yCapyTildeDiff * yCapyTildeDiff;
+		this->sumCapYYDiff_ += yCapyDiff;
+		this->sumCapYYDiffProduct_ += yCapyDiff * yCapyDiff;
+	}
+
+	void Merge(const ResidualAccumulator& other) {
+		this->sumCapY_ += other.sumCapY_;
+		this->sumCapYTildeYDiff_ += other.sumCapYTildeYDiff_;
+		this->sumCapYTildeYDiffProduct_ += other.sumCapYTildeYDiffProduct_;
+		this->sumCapYYDiff_ += other.sumCapYYDiff_;
+		this->sumCapYYDiffProduct_ += other.sumCapYYDiffProduct_;
+	}
+
+	[[nodiscard]] value_type GetSumCapY() const {
+		return this->sumCapY_;
+	}
+
+	[[nodiscard]] value_type GetSumCapYTildeYDiff() const {
+		return this->sumCapYTildeYDiff_;
+	}
+
+	[[nodiscard]] value_type GetSumCapYTildeYDiffProduct() const {
+		return this->sumCapYTildeYDiffProduct_;
+	}
+
+	[[nodiscard]] value_type GetSumCapYYDiff() const {
+		return this->sumCapYYDiff_;
+	}
+
+	[[nodiscard]] value_type GetSumCapYYDiffProduct() const {
+		return this->sumCapYYDiffProduct_;
+	}
+
+private:
+	value_type alphaOne_{};
+	value_type alphaZero_{};
+	value_type yExpectedValue_{};
+
+	value_type sumCapY_{};
+	value_type sumCapYTildeYDiff_{};
+	value_type sumCapYTildeYDiffProduct_{};
+	value_type sumCapYYDiff_{};
+	value_type sumCapYYDiffProduct_{};
+};
@@ -0,0 +1,610 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(__x86_64__)
+	#define MOMENT_KERNELS_X64
+	#include <immintrin.h>
+
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#endif
+#endif
+
+// GCC contracts a * b + c into FMA wherever the target allows it (AVX-512 implies FMA),
+// which would round differently from the SSE2 and scalar paths, so contraction is off in the kernels.
+#if defined(MOMENT_KERNELS_X64) && defined(__clang__)
+	#define MOMENT_KERNELS_TARGET(isa) __attribute__((target(isa)))
+#elif defined(MOMENT_KERNELS_X64) && !defined(_MSC_VER)
+	#define MOMENT_KERNELS_TARGET(isa) __attribute__((target(isa), optimize("fp-contract=off")))
+#else
+	#define MOMENT_KERNELS_TARGET(isa)
+#endif
+
+#include "CenteredMoments.hpp"
+#include "MomentAccumulator.hpp"
+
+enum class Summation {
+	Naive,
+	Kahan
+};
+
+enum class InstructionSet {
+	Scalar,
+	Sse2,
+	Avx2,
+	Avx512
+};
+
+template<class T, bool Kahan>
+class LaneSum {
+private:
+	using value_type = T;
+
+public:
+	void Add(value_type value) {
+		if constexpr (Kahan) {
+			const auto y = value - this->compensation_;
+			const auto t = this->sum_ + y;
+
+			this->compensation_ = (t - this->sum_) - y;
+			this->sum_ = t;
+		}
+		else {
+			this->sum_ += value;
+		}
+	}
+
+	[[nodiscard]] value_type Get() const {
+		return this->sum_;
+	}
+
+private:
+	value_type sum_{};
+	value_type compensation_{};
+};
+
+class MomentKernels {
+private:
+	static constexpr std::size_t SUMS_COUNT = 5u;
+
+	template<class T, bool Kahan>
+	using Sums = std::array<LaneSum<T, Kahan>, MomentKernels::SUMS_COUNT>;
+
+public:
+	[[nodiscard]] static InstructionSet GetInstructionSet() {
+		static const auto INSTRUCTION_SET = MomentKernels::DetectInstructionSet();
+		return INSTRUCTION_SET;
+	}
+
+	// Fused sweep: n, sum x, sum y, sum xy, sum x^2, sum y^2.
+	// T is the storage type, the sums are accumulated in A (float points with double sums, for example).
+	template<class T, class A = T>
+	[[nodiscard]] static MomentAccumulator<A> AccumulateMoments(std::span<const T> x, std::span<const T> y,
+		Summation summation, InstructionSet instructionSet = MomentKernels::GetInstructionSet()) {
+		if (summation == Summation::Kahan) {
+			return MomentKernels::AccumulateMoments<T, A, true>(x, y, instructionSet);
+		}
+
+		return MomentKernels::AccumulateMoments<T, A, false>(x, y, instructionSet);
+	}
+
+	// The same sweep over x - xExpectedValue and y - yExpectedValue. Any estimate of the means works,
+	// the first-order sums of the deviations correct it (corrected two-pass algorithm).
+	// The means are returned relative to (xOrigin, yOrigin): chunks far from zero then merge
+	// without subtracting two large means.
+	template<class T, class A = T>
+	[[nodiscard]] static CenteredMoments<A> AccumulateCenteredMoments(std::span<const T> x, std::span<const T> y,
+		A xExpectedValue, A yExpectedValue, A xOrigin, A yOrigin,
+		Summation summation, InstructionSet instructionSet = MomentKernels::GetInstructionSet()) {
+		const auto deviations = summation == Summation::Kahan
+			? MomentKernels::AccumulateMoments<T, A, true>(x, y, instructionSet, xExpectedValue, yExpectedValue)
+			: MomentKernels::AccumulateMoments<T, A, false>(x, y, instructionSet, xExpectedValue, yExpectedValue);
+
+		if (x.empty()) {
+			return CenteredMoments<A>{};
+		}
+
+		const auto n = static_cast<A>(x.size());
+
+		const auto sumDx = deviations.GetSumX();
+		const auto sumDy = deviations.GetSumY();
+
+		return CenteredMoments<A>{
+			x.size(),
+			(xExpectedValue - xOrigin) + sumDx / n,
+			(yExpectedValue - yOrigin) + sumDy / n,
+			deviations.GetSumXXProduct() - sumDx * sumDx / n,
+			deviations.GetSumYYProduct() - sumDy * sumDy / n,
+			deviations.GetSumXYProduct() - sumDx * sumDy / n
+		};
+	}
+
+	// Fused sweep over ^y_i = alphaOne * x_i + alphaZero and both residual columns.
+	template<class T, class A = T>
+	[[nodiscard]] static ResidualAccumulator<A> AccumulateResiduals(std::span<const T> x, std::span<const T> y,
+		A alphaOne, A alphaZero, A yExpectedValue,
+		Summation summation, InstructionSet instructionSet = MomentKernels::GetInstructionSet()) {
+		if (summation == Summation::Kahan) {
+			return MomentKernels::AccumulateResiduals<T, A, true>(x, y, alphaOne, alphaZero, yExpectedValue, instructionSet);
+		}
+
+		return MomentKernels::AccumulateResiduals<T, A, false>(x, y, alphaOne, alphaZero, yExpectedValue, instructionSet);
+	}
+
+private:
+	static InstructionSet DetectInstructionSet() {
+	#if defined(MOMENT_KERNELS_X64) && defined(_MSC_VER)
+		int info[4]{};
+
+		__cpuid(info, 0);
+		const auto maxLeaf = info[0];
+
+		__cpuid(info, 1);
+		const auto hasOsxsave = (info[2] & (1 << 27)) != 0;
+		const auto hasAvx     = (info[2] & (1 << 28)) != 0;
+
+		if (!hasOsxsave || !hasAvx || maxLeaf < 7) {
+			return InstructionSet::Sse2;
+		}
+
+		const auto xcr0 = _xgetbv(0);
+
+		if ((xcr0 & 0x6) != 0x6) {
+			return InstructionSet::Sse2;
+		}
+
+		__cpuidex(info, 7, 0);
+		const auto hasAvx2    = (info[1] & (1 << 5)) != 0;
+		const auto hasAvx512F = (info[1] & (1 << 16)) != 0;
+
+		if (hasAvx512F && (xcr0 & 0xE6) == 0xE6) {
+			return InstructionSet::Avx512;
+		}
+
+		return hasAvx2 ? InstructionSet::Avx2 : InstructionSet::Sse2;
+	#elif defined(MOMENT_KERNELS_X64)
+		__builtin_cpu_init();
+
+		if (__builtin_cpu_supports("avx512f")) {
+			return InstructionSet::Avx512;
+		}
+
+		if (__builtin_cpu_supports("avx2")) {
+			return InstructionSet::Avx2;
+		}
+
+		return InstructionSet::Sse2;
+	#else
+		return InstructionSet::Scalar;
+	#endif
+	}
+
+	// The vector kernels accumulate doubles and read either doubles or floats.
+	template<class T, class A>
+	static constexpr bool HAS_VECTOR_KERNELS = std::is_same_v<A, double> &&
+		(std::is_same_v<T, double> || std::is_same_v<T, float>);
+
+	template<class T, class A, bool Kahan>
+	static MomentAccumulator<A> AccumulateMoments(std::span<const T> x, std::span<const T> y, InstructionSet instructionSet,
+		A xShift = A{}, A yShift = A{}) {
+		Sums<A, Kahan> sums{};
+		std::size_t i = 0u;
+
+	#if defined(MOMENT_KERNELS_X64)
+		if constexpr (MomentKernels::HAS_VECTOR_KERNELS<T, A>) {
+			switch (instructionSet) {
+			case InstructionSet::Avx512:
+				i = MomentKernels::MomentsAvx512<Kahan>(x.data(), y.data(), x.size(), xShift, yShift, sums);
+				break;
+			case InstructionSet::Avx2:
+				i = MomentKernels::MomentsAvx2<Kahan>(x.data(), y.data(), x.size(), xShift, yShift, sums);
+				break;
+			case InstructionSet::Sse2:
+				i = MomentKernels::MomentsSse2<Kahan>(x.data(), y.data(), x.size(), xShift, yShift, sums);
+				break;
+			default:
+				break;
+			}
+		}
+	#endif
+
+		for (; i < x.size(); ++i) {
+			const auto dx = static_cast<A>(x[i]) - xShift;
+			const auto dy = static_cast<A>(y[i]) - yShift;
+
+			sums[0].Add(dx);
+			sums[1].Add(dy);
+			sums[2].Add(dx * dy);
+			sums[3].Add(dx * dx);
+			sums[4].Add(dy * dy);
+		}
+
+		return MomentAccumulator<A>{
+			x.size(), sums[0].Get(), sums[1].Get(), sums[2].Get(), sums[3].Get(), sums[4].Get()
+		};
+	}
+
+	template<class T, class A, bool Kahan>
+	static ResidualAccumulator<A> AccumulateResiduals(std::span<const T> x, std::span<const T> y,
+		A alphaOne, A alphaZero, A yExpectedValue, InstructionSet instructionSet) {
+		Sums<A, Kahan> sums{};
+		std::size_t i = 0u;
+
+	#if defined(MOMENT_KERNELS_X64)
+		if constexpr (MomentKernels::HAS_VECTOR_KERNELS<T, A>) {
+			switch (instructionSet) {
+			case InstructionSet::Avx512:
+				i = MomentKernels::ResidualsAvx512<Kahan>(x.data(), y.data(), x.size(),
+					alphaOne, alphaZero, yExpectedValue, sums);
+				break;
+			case InstructionSet::Avx2:
+				i = MomentKernels::ResidualsAvx2<Kahan>(x.data(), y.data(), x.size(),
+					alphaOne, alphaZero, yExpectedValue, sums);
+				break;
+			case InstructionSet::Sse2:
+				i = MomentKernels::ResidualsSse2<Kahan>(x.data(), y.data(), x.size(),
+					alphaOne, alphaZero, yExpectedValue, sums);
+				break;
+			default:
+				break;
+			}
+		}
+	#endif
+
+		for (; i < x.size(); ++i) {
+			const auto yCap = alphaOne * static_cast<A>(x[i]) + alphaZero;
+			const auto yCapyTildeDiff = yCap - yExpectedValue;
+			const auto yCapyDiff = yCap - static_cast<A>(y[i]);
+
+			sums[0].Add(yCap);
+			sums[1].Add(yCapyTildeDiff);
+			sums[2].Add(yCapyTildeDiff * yCapyTildeDiff);
+			sums[3].Add(yCapyDiff);
+			sums[4].Add(yCapyDiff * yCapyDiff);
+		}
+
+		return ResidualAccumulator<A>{
+			alphaOne, alphaZero, yExpectedValue,
+			sums[0].Get(), sums[1].Get(), sums[2].Get(), sums[3].Get(), sums[4].Get()
+		};
+	}
+
+#if defined(MOMENT_KERNELS_X64)
+	//-------------------- SSE2 -------------------------------------------//
+
+	static __m128d LoadSse2(const double* values) {
+		return _mm_loadu_pd(values);
+	}
+
+	static __m128d LoadSse2(const float* values) {
+		return _mm_cvtps_pd(_mm_castsi128_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values))));
+	}
+
+	template<bool Kahan>
+	static void AddSse2(__m128d& sum, __m128d& compensation, __m128d value) {
+		if constexpr (Kahan) {
+			const auto y = _mm_sub_pd(value, compensation);
+			const auto t = _mm_add_pd(sum, y);
+
+			compensation = _mm_sub_pd(_mm_sub_pd(t, sum), y);
+			sum = t;
+		}
+		else {
+			sum = _mm_add_pd(sum, value);
+		}
+	}
+
+	template<bool Kahan>
+	static void ReduceSse2(const __m128d (&sum)[SUMS_COUNT], const __m128d (&compensation)[SUMS_COUNT],
+		Sums<double, Kahan>& sums) {
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			alignas(16) double lanes[2];
+			alignas(16) double compensations[2];
+
+			_mm_store_pd(lanes, sum[j]);
+			_mm_store_pd(compensations, compensation[j]);
+
+			for (std::size_t lane = 0u; lane < 2u; ++lane) {
+				sums[j].Add(lanes[lane]);
+				sums[j].Add(-compensations[lane]);
+			}
+		}
+	}
+
+	template<bool Kahan, class In>
+	static std::size_t MomentsSse2(const In* x, const In* y, std::size_t size,
+		double xShift, double yShift, Sums<double, Kahan>& sums) {
+		__m128d sum[SUMS_COUNT];
+		__m128d compensation[SUMS_COUNT];
+
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			sum[j] = _mm_setzero_pd();
+			compensation[j] = _mm_setzero_pd();
+		}
+
+		const auto sx = _mm_set1_pd(xShift);
+		const auto sy = _mm_set1_pd(yShift);
+
+		std::size_t i = 0u;
+
+		for (; i + 2u <= size; i += 2u) {
+			const auto vx = _mm_sub_pd(MomentKernels::LoadSse2(x + i), sx);
+			const auto vy = _mm_sub_pd(MomentKernels::LoadSse2(y + i), sy);
+
+			MomentKernels::AddSse2<Kahan>(sum[0], compensation[0], vx);
+			MomentKernels::AddSse2<Kahan>(sum[1], compensation[1], vy);
+			MomentKernels::AddSse2<Kahan>(sum[2], compensation[2], _mm_mul_pd(vx, vy));
+			MomentKernels::AddSse2<Kahan>(sum[3], compensation[3], _mm_mul_pd(vx, vx));
+			MomentKernels::AddSse2<Kahan>(sum[4], compensation[4], _mm_mul_pd(vy, vy));
+		}
+
+		MomentKernels::ReduceSse2<Kahan>(sum, compensation, sums);
+
+		return i;
+	}
+
+	template<bool Kahan, class In>
+	static std::size_t ResidualsSse2(const In* x, const In* y, std::size_t size,
+		double alphaOne, double alphaZero, double yExpectedValue, Sums<double, Kahan>& sums) {
+		__m128d sum[SUMS_COUNT];
+		__m128d compensation[SUMS_COUNT];
+
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			sum[j] = _mm_setzero_pd();
+			compensation[j] = _mm_setzero_pd();
+		}
+
+		const auto a1 = _mm_set1_pd(alphaOne);
+		const auto a0 = _mm_set1_pd(alphaZero);
+		const auto yTilde = _mm_set1_pd(yExpectedValue);
+
+		std::size_t i = 0u;
+
+		for (; i + 2u <= size; i += 2u) {
+			const auto yCap = _mm_add_pd(_mm_mul_pd(a1, MomentKernels::LoadSse2(x + i)), a0);
+			const auto yCapyTildeDiff = _mm_sub_pd(yCap, yTilde);
+			const auto yCapyDiff = _mm_sub_pd(yCap, MomentKernels::LoadSse2(y + i));
+
+			MomentKernels::AddSse2<Kahan>(sum[0], compensation[0], yCap);
+			MomentKernels::AddSse2<Kahan>(sum[1], compensation[1], yCapyTildeDiff);
+			MomentKernels::AddSse2<Kahan>(sum[2], compensation[2], _mm_mul_pd(yCapyTildeDiff, yCapyTildeDiff));
+			MomentKernels::AddSse2<Kahan>(sum[3], compensation[3], yCapyDiff);
+			MomentKernels::AddSse2<Kahan>(sum[4], compensation[4], _mm_mul_pd(yCapyDiff, yCapyDiff));
+		}
+
+		MomentKernels::ReduceSse2<Kahan>(sum, compensation, sums);
+
+		return i;
+	}
+
+	//-------------------- AVX2 -------------------------------------------//
+
+	MOMENT_KERNELS_TARGET("avx2")
+	static __m256d LoadAvx2(const double* values) {
+		return _mm256_loadu_pd(values);
+	}
+
+	MOMENT_KERNELS_TARGET("avx2")
+	static __m256d LoadAvx2(const float* values) {
+		return _mm256_cvtps_pd(_mm_loadu_ps(values));
+	}
+
+	template<bool Kahan>
+	MOMENT_KERNELS_TARGET("avx2")
+	static void AddAvx2(__m256d& sum, __m256d& compensation, __m256d value) {
+		if constexpr (Kahan) {
+			const auto y = _mm256_sub_pd(value, compensation);
+			const auto t = _mm256_add_pd(sum, y);
+
+			compensation = _mm256_sub_pd(_mm256_sub_pd(t, sum), y);
+			sum = t;
+		}
+		else {
+			sum = _mm256_add_pd(sum, value);
+		}
+	}
+
+	template<bool Kahan>
+	MOMENT_KERNELS_TARGET("avx2")
+	static void ReduceAvx2(const __m256d (&sum)[SUMS_COUNT], const __m256d (&compensation)[SUMS_COUNT],
+		Sums<double, Kahan>& sums) {
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			alignas(32) double lanes[4];
+			alignas(32) double compensations[4];
+
+			_mm256_store_pd(lanes, sum[j]);
+			_mm256_store_pd(compensations, compensation[j]);
+
+			for (std::size_t lane = 0u; lane < 4u; ++lane) {
+				sums[j].Add(lanes[lane]);
+				sums[j].Add(-compensations[lane]);
+			}
+		}
+	}
+
+	template<bool Kahan, class In>
+	MOMENT_KERNELS_TARGET("avx2")
+	static std::size_t MomentsAvx2(const In* x, const In* y, std::size_t size,
+		double xShift, double yShift, Sums<double, Kahan>& sums) {
+		__m256d sum[SUMS_COUNT];
+		__m256d compensation[SUMS_COUNT];
+
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			sum[j] = _mm256_setzero_pd();
+			compensation[j] = _mm256_setzero_pd();
+		}
+
+		const auto sx = _mm256_set1_pd(xShift);
+		const auto sy = _mm256_set1_pd(yShift);
+
+		std::size_t i = 0u;
+
+		for (; i + 4u <= size; i += 4u) {
+			const auto vx = _mm256_sub_pd(MomentKernels::LoadAvx2(x + i), sx);
+			const auto vy = _mm256_sub_pd(MomentKernels::LoadAvx2(y + i), sy);
+
+			MomentKernels::AddAvx2<Kahan>(sum[0], compensation[0], vx);
+			MomentKernels::AddAvx2<Kahan>(sum[1], compensation[1], vy);
+			MomentKernels::AddAvx2<Kahan>(sum[2], compensation[2], _mm256_mul_pd(vx, vy));
+			MomentKernels::AddAvx2<Kahan>(sum[3], compensation[3], _mm256_mul_pd(vx, vx));
+			MomentKernels::AddAvx2<Kahan>(sum[4], compensation[4], _mm256_mul_pd(vy, vy));
+		}
+
+		MomentKernels::ReduceAvx2<Kahan>(sum, compensation, sums);
+
+		return i;
+	}
+
+	template<bool Kahan, class In>
+	MOMENT_KERNELS_TARGET("avx2")
+	static std::size_t ResidualsAvx2(const In* x, const In* y, std::size_t size,
+		double alphaOne, double alphaZero, double yExpectedValue, Sums<double, Kahan>& sums) {
+		__m256d sum[SUMS_COUNT];
+		__m256d compensation[SUMS_COUNT];
+
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			sum[j] = _mm256_setzero_pd();
+			compensation[j] = _mm256_setzero_pd();
+		}
+
+		const auto a1 = _mm256_set1_pd(alphaOne);
+		const auto a0 = _mm256_set1_pd(alphaZero);
+		const auto yTilde = _mm256_set1_pd(yExpectedValue);
+
+		std::size_t i = 0u;
+
+		for (; i + 4u <= size; i += 4u) {
+			// No FMA: every path rounds a1 * x before adding a0, so the residual sums don't depend on the ISA.
+			const auto yCap = _mm256_add_pd(_mm256_mul_pd(a1, MomentKernels::LoadAvx2(x + i)), a0);
+			const auto yCapyTildeDiff = _mm256_sub_pd(yCap, yTilde);
+			const auto yCapyDiff = _mm256_sub_pd(yCap, MomentKernels::LoadAvx2(y + i));
+
+			MomentKernels::AddAvx2<Kahan>(sum[0], compensation[0], yCap);
+			MomentKernels::AddAvx2<Kahan>(sum[1], compensation[1], yCapyTildeDiff);
+			MomentKernels::AddAvx2<Kahan>(sum[2], compensation[2], _mm256_mul_pd(yCapyTildeDiff, yCapyTildeDiff));
+			MomentKernels::AddAvx2<Kahan>(sum[3], compensation[3], yCapyDiff);
+			MomentKernels::AddAvx2<Kahan>(sum[4], compensation[4], _mm256_mul_pd(yCapyDiff, yCapyDiff));
+		}
+
+		MomentKernels::ReduceAvx2<Kahan>(sum, compensation, sums);
+
+		return i;
+	}
+
+	//-------------------- AVX-512 ----------------------------------------//
+
+	MOMENT_KERNELS_TARGET("avx512f")
+	static __m512d LoadAvx512(const double* values) {
+		return _mm512_loadu_pd(values);
+	}
+
+	MOMENT_KERNELS_TARGET("avx512f")
+	static __m512d LoadAvx512(const float* values) {
+		return _mm512_cvtps_pd(_mm256_loadu_ps(values));
+	}
+
+	template<bool Kahan>
+	MOMENT_KERNELS_TARGET("avx512f")
+	static void AddAvx512(__m512d& sum, __m512d& compensation, __m512d value) {
+		if constexpr (Kahan) {
+			const auto y = _mm512_sub_pd(value, compensation);
+			const auto t = _mm512_add_pd(sum, y);
+
+			compensation = _mm512_sub_pd(_mm512_sub_pd(t, sum), y);
+			sum = t;
+		}
+		else {
+			sum = _mm512_add_pd(sum, value);
+		}
+	}
+
+	template<bool Kahan>
+	MOMENT_KERNELS_TARGET("avx512f")
+	static void ReduceAvx512(const __m512d (&sum)[SUMS_COUNT], const __m512d (&compensation)[SUMS_COUNT],
+		Sums<double, Kahan>& sums) {
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			alignas(64) double lanes[8];
+			alignas(64) double compensations[8];
+
+			_mm512_store_pd(lanes, sum[j]);
+			_mm512_store_pd(compensations, compensation[j]);
+
+			for (std::size_t lane = 0u; lane < 8u; ++lane) {
+				sums[j].Add(lanes[lane]);
+				sums[j].Add(-compensations[lane]);
+			}
+		}
+	}
+
+	template<bool Kahan, class In>
+	MOMENT_KERNELS_TARGET("avx512f")
+	static std::size_t MomentsAvx512(const In* x, const In* y, std::size_t size,
+		double xShift, double yShift, Sums<double, Kahan>& sums) {
+		__m512d sum[SUMS_COUNT];
+		__m512d compensation[SUMS_COUNT];
+
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			sum[j] = _mm512_setzero_pd();
+			compensation[j] = _mm512_setzero_pd();
+		}
+
+		const auto sx = _mm512_set1_pd(xShift);
+		const auto sy = _mm512_set1_pd(yShift);
+
+		std::size_t i = 0u;
+
+		for (; i + 8u <= size; i += 8u) {
+			const auto vx = _mm512_sub_pd(MomentKernels::LoadAvx512(x + i), sx);
+			const auto vy = _mm512_sub_pd(MomentKernels::LoadAvx512(y + i), sy);
+
+			MomentKernels::AddAvx512<Kahan>(sum[0], compensation[0], vx);
+			MomentKernels::AddAvx512<Kahan>(sum[1], compensation[1], vy);
+			MomentKernels::AddAvx512<Kahan>(sum[2], compensation[2], _mm512_mul_pd(vx, vy));
+			MomentKernels::AddAvx512<Kahan>(sum[3], compensation[3], _mm512_mul_pd(vx, vx));
+			MomentKernels::AddAvx512<Kahan>(sum[4], compensation[4], _mm512_mul_pd(vy, vy));
+		}
+
+		MomentKernels::ReduceAvx512<Kahan>(sum, compensation, sums);
+
+		return i;
+	}
+
+	template<bool Kahan, class In>
+	MOMENT_KERNELS_TARGET("avx512f")
+	static std::size_t ResidualsAvx512(const In* x, const In* y, std::size_t size,
+		double alphaOne, double alphaZero, double yExpectedValue, Sums<double, Kahan>& sums) {
+		__m512d sum[SUMS_COUNT];
+		__m512d compensation[SUMS_COUNT];
+
+		for (std::size_t j = 0u; j < MomentKernels::SUMS_COUNT; ++j) {
+			sum[j] = _mm512_setzero_pd();
+			compensation[j] = _mm512_setzero_pd();
+		}
+
+		const auto a1 = _mm512_set1_pd(alphaOne);
+		const auto a0 = _mm512_set1_pd(alphaZero);
+		const auto yTilde = _mm512_set1_pd(yExpectedValue);
+
+		std::size_t i = 0u;
+
+		for (; i + 8u <= size; i += 8u) {
+			const auto yCap = _mm512_add_pd(_mm512_mul_pd(a1, MomentKernels::LoadAvx512(x + i)), a0);
+			const auto yCapyTildeDiff = _mm512_sub_pd(yCap, yTilde);
+			const auto yCapyDiff = _mm512_sub_pd(yCap, MomentKernels::LoadAvx512(y + i));
+
+			MomentKernels::AddAvx512<Kahan>(sum[0], compensation[0], yCap);
+			MomentKernels::AddAvx512<Kahan>(sum[1], compensation[1], yCapyTildeDiff);
+			MomentKernels::AddAvx512<Kahan>(sum[2], compensation[2], _mm512_mul_pd(yCapyTildeDiff, yCapyTildeDiff));
+			MomentKernels::AddAvx512<Kahan>(sum[3], compensation[3], yCapyDiff);
+			MomentKernels::AddAvx512<Kahan>(sum[4], compensation[4], _mm512_mul_pd(yCapyDiff, yCapyDiff));
+		}
+
+		MomentKernels::ReduceAvx512<Kahan>(sum, compensation, sums);
+
+		return i;
+	}
+#endif
+};
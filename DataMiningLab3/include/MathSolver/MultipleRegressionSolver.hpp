@@ -0,0 +1,385 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "SolverOptions.hpp"
+#include "Point/DesignMatrix.hpp"
+
+// Least squares fit of y = a0 + a1 x1 + ... + ak xk through the centered normal equations.
+// X^T X is accumulated over row tiles small enough to stay in cache and solved by Cholesky.
+template<class T> requires std::is_floating_point_v<T>
+class MultipleRegressionSolver final {
+private:
+	using value_type = T;
+
+	static constexpr std::size_t CHUNK_SIZE = 1u << 14u;
+	static constexpr std::size_t TILE_SIZE = 256u;
+
+	// Centered cross products over a range of rows, only the upper triangle of xx is filled.
+	struct CrossProducts {
+		std::vector<value_type> xx;
+		std::vector<value_type> xy;
+		value_type yy{};
+
+		void Merge(const CrossProducts& other) {
+			std::transform(this->xx.begin(), this->xx.end(), other.xx.begin(), this->xx.begin(), std::plus<>{});
+			std::transform(this->xy.begin(), this->xy.end(), other.xy.begin(), this->xy.begin(), std::plus<>{});
+			this->yy += other.yy;
+		}
+	};
+
+	struct Residuals {
+		value_type sumSquaredRegression{};
+		value_type sumSquaredError{};
+
+		void Merge(const Residuals& other) {
+			this->sumSquaredRegression += other.sumSquaredRegression;
+			this->sumSquaredError += other.sumSquaredError;
+		}
+	};
+
+public:
+	explicit MultipleRegressionSolver(DesignMatrixView<value_type> data, const SolverOptions& options = {})
+		: data_(data), options_(options) {
+		this->Solve();
+	}
+
+	MultipleRegressionSolver(const MultipleRegressionSolver&) = delete;
+
+	MultipleRegressionSolver(MultipleRegressionSolver&&) noexcept = default;
+
+	~MultipleRegressionSolver() noexcept = default;
+
+	MultipleRegressionSolver& operator=(const MultipleRegressionSolver&) = delete;
+
+	MultipleRegressionSolver& operator=(MultipleRegressionSolver&&) noexcept = default;
+
+	//-------------------- GETTERS ---------------------------------------//
+
+	// a1 .. ak.
+	[[nodiscard]] std::span<const value_type> GetCoefficients() const {
+		return this->coefficients_;
+	}
+
+	// a0.
+	[[nodiscard]] value_type GetIntercept() const {
+		return this->intercept_;
+	}
+
+	[[nodiscard]] std::span<const value_type> GetXExpectedValues() const {
+		return this->xExpectedValues_;
+	}
+
+	[[nodiscard]] value_type GetYExpectedValue() const {
+		return this->yExpectedValue_;
+	}
+
+	[[nodiscard]] value_type GetSumSquaredRegression() const {
+		return this->residuals_.sumSquaredRegression;
+	}
+
+	[[nodiscard]] value_type GetSumSquaredError() const {
+		return this->residuals_.sumSquaredError;
+	}
+
+	[[nodiscard]] value_type GetDeterminationCoefficient() const {
+		const auto total = this->GetSumSquaredRegression() + this->GetSumSquaredError();
+		return this->GetSumSquaredRegression() / total;
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->data_.GetRowCount();
+	}
+
+	[[nodiscard]] int GetK() const {
+		return static_cast<int>(this->data_.GetColumnCount());
+	}
+
+	//---------------------- MATH -----------------------------------------//
+
+	[[nodiscard]] value_type GetFStatistics() const {
+		const auto k = this->GetK();
+
+		const auto chisl = this->GetSumSquaredRegression() * static_cast<value_type>(this->GetSize() - k - 1);
+		const auto zname = this->GetSumSquaredError() * k;
+
+		return chisl / zname;
+	}
+
+private:
+	DesignMatrixView<value_type> data_;
+
+	SolverOptions options_;
+
+	std::vector<value_type> xExpectedValues_;
+	value_type yExpectedValue_{};
+
+	std::vector<value_type> coefficients_;
+	value_type intercept_{};
+
+	Residuals residuals_;
+
+	void Solve() {
+		const auto n = this->data_.GetRowCount();
+		const auto k = this->data_.GetColumnCount();
+
+		if (k == 0u || n <= k + 1u) {
+			throw std::runtime_error("Not enough observations for the number of regressors!");
+		}
+
+		this->AccumulateMeans();
+
+		auto products = this->AccumulateCrossProducts();
+		this->coefficients_ = MultipleRegressionSolver::SolveCholesky(products.xx, products.xy, k);
+
+		this->intercept_ = this->yExpectedValue_;
+
+		for (std::size_t j = 0u; j < k; ++j) {
+			this->intercept_ -= this->coefficients_[j] * this->xExpectedValues_[j];
+		}
+
+		this->AccumulateResiduals();
+	}
+
+	void AccumulateMeans() {
+		const auto k = this->data_.GetColumnCount();
+
+		std::vector<std::vector<value_type>> chunks(this->GetChunkCount());
+
+		this->ForEachChunk(chunks.size(), [k, &chunks](std::size_t chunk, const DesignMatrixView<value_type>& view) {
+			auto& sums = chunks[chunk];
+			sums.resize(k + 1u);
+
+			for (std::size_t j = 0u; j < k; ++j) {
+				sums[j] = MultipleRegressionSolver::Sum(view.GetColumn(j));
+			}
+
+			sums[k] = MultipleRegressionSolver::Sum(view.GetY());
+		});
+
+		std::vector<value_type> sums(k + 1u);
+
+		for (const auto& chunk : chunks) {
+			std::transform(sums.begin(), sums.end(), chunk.begin(), sums.begin(), std::plus<>{});
+		}
+
+		const auto n = static_cast<value_type>(this->data_.GetRowCount());
+
+		this->xExpectedValues_.resize(k);
+		std::transform(sums.begin(), sums.end() - 1, this->xExpectedValues_.begin(), [n](value_type sum) {
+			return sum / n;
+		});
+
+		this->yExpectedValue_ = sums[k] / n;
+	}
+
+	[[nodiscard]] CrossProducts AccumulateCrossProducts() const {
+		const auto k = this->data_.GetColumnCount();
+
+		std::vector<CrossProducts> chunks(this->GetChunkCount());
+
+		this->ForEachChunk(chunks.size(), [this, k, &chunks](std::size_t chunk, const DesignMatrixView<value_type>& view) {
+			auto& products = chunks[chunk];
+			products.xx.assign(k * k, value_type{});
+			products.xy.assign(k, value_type{});
+
+			// Centered tile, column-major TILE_SIZE x (k + 1) with y in the last column.
+			std::vector<value_type> tile((k + 1u) * MultipleRegressionSolver::TILE_SIZE);
+
+			for (std::size_t offset = 0u; offset < view.GetRowCount(); offset += MultipleRegressionSolver::TILE_SIZE) {
+				const auto rows = std::min(MultipleRegressionSolver::TILE_SIZE, view.GetRowCount() - offset);
+
+				this->LoadCenteredTile(view.GetSubView(offset, rows), tile);
+
+				const auto column = [&tile, rows](std::size_t j) {
+					return std::span<const value_type>{ tile.data() + j * MultipleRegressionSolver::TILE_SIZE, rows };
+				};
+
+				for (std::size_t i = 0u; i < k; ++i) {
+					for (std::size_t j = i; j < k; ++j) {
+						products.xx[i * k + j] += MultipleRegressionSolver::Dot(column(i), column(j));
+					}
+
+					products.xy[i] += MultipleRegressionSolver::Dot(column(i), column(k));
+				}
+
+				products.yy += MultipleRegressionSolver::Dot(column(k), column(k));
+			}
+		});
+
+		CrossProducts result{ std::vector<value_type>(k * k), std::vector<value_type>(k), value_type{} };
+
+		for (const auto& chunk : chunks) {
+			result.Merge(chunk);
+		}
+
+		return result;
+	}
+
+	void AccumulateResiduals() {
+		const auto k = this->data_.GetColumnCount();
+
+		std::vector<Residuals> chunks(this->GetChunkCount());
+
+		this->ForEachChunk(chunks.size(), [this, k, &chunks](std::size_t chunk, const DesignMatrixView<value_type>& view) {
+			std::vector<value_type> prediction(MultipleRegressionSolver::TILE_SIZE);
+
+			for (std::size_t offset = 0u; offset < view.GetRowCount(); offset += MultipleRegressionSolver::TILE_SIZE) {
+				const auto rows = std::min(MultipleRegressionSolver::TILE_SIZE, view.GetRowCount() - offset);
+				const auto tile = view.GetSubView(offset, rows);
+
+				std::fill_n(prediction.begin(), rows, this->intercept_);
+
+				for (std::size_t j = 0u; j < k; ++j) {
+					const auto x = tile.GetColumn(j);
+					const auto coefficient = this->coefficients_[j];
+
+					for (std::size_t i = 0u; i < rows; ++i) {
+						prediction[i] += coefficient * x[i];
+					}
+				}
+
+				const auto y = tile.GetY();
+
+				for (std::size_t i = 0u; i < rows; ++i) {
+					const auto regression = prediction[i] - this->yExpectedValue_;
+					const auto error = prediction[i] - y[i];
+
+					chunks[chunk].sumSquaredRegression += regression * regression;
+					chunks[chunk].sumSquaredError += error * error;
+				}
+			}
+		});
+
+		for (const auto& chunk : chunks) {
+			this->residuals_.Merge(chunk);
+		}
+	}
+
+	void LoadCenteredTile(const DesignMatrixView<value_type>& view, std::vector<value_type>& tile) const {
+		const auto k = view.GetColumnCount();
+
+		const auto load = [&tile, rows = view.GetRowCount()](std::size_t j, std::span<const value_type> column, value_type mean) {
+			auto* target = tile.data() + j * MultipleRegressionSolver::TILE_SIZE;
+
+			for (std::size_t i = 0u; i < rows; ++i) {
+				target[i] = column[i] - mean;
+			}
+		};
+
+		for (std::size_t j = 0u; j < k; ++j) {
+			load(j, view.GetColumn(j), this->xExpectedValues_[j]);
+		}
+
+		load(k, view.GetY(), this->yExpectedValue_);
+	}
+
+	// Solves A b = c for the symmetric positive definite A given by its upper triangle.
+	[[nodiscard]] static std::vector<value_type> SolveCholesky(std::vector<value_type> a, std::vector<value_type> c, std::size_t k) {
+		// Lower factor L is written over the lower triangle, A = L L^T.
+		for (std::size_t j = 0u; j < k; ++j) {
+			auto diagonal = a[j * k + j];
+
+			for (std::size_t p = 0u; p < j; ++p) {
+				diagonal -= a[j * k + p] * a[j * k + p];
+			}
+
+			if (!(diagonal > std::numeric_limits<value_type>::epsilon() * a[j * k + j])) {
+				throw std::runtime_error("Regressors are linearly dependent!");
+			}
+
+			a[j * k + j] = std::sqrt(diagonal);
+
+			for (std::size_t i = j + 1u; i < k; ++i) {
+				auto value = a[j * k + i];
+
+				for (std::size_t p = 0u; p < j; ++p) {
+					value -= a[i * k + p] * a[j * k + p];
+				}
+
+				a[i * k + j] = value / a[j * k + j];
+			}
+		}
+
+		// L z = c, then L^T b = z.
+		for (std::size_t i = 0u; i < k; ++i) {
+			for (std::size_t p = 0u; p < i; ++p) {
+				c[i] -= a[i * k + p] * c[p];
+			}
+
+			c[i] /= a[i * k + i];
+		}
+
+		for (std::size_t i = k; i-- > 0u;) {
+			for (std::size_t p = i + 1u; p < k; ++p) {
+				c[i] -= a[p * k + i] * c[p];
+			}
+
+			c[i] /= a[i * k + i];
+		}
+
+		return c;
+	}
+
+	[[nodiscard]] static value_type Sum(std::span<const value_type> values) {
+		return MultipleRegressionSolver::Reduce(values.size(), [&values](std::size_t i) {
+			return values[i];
+		});
+	}
+
+	[[nodiscard]] static value_type Dot(std::span<const value_type> a, std::span<const value_type> b) {
+		return MultipleRegressionSolver::Reduce(a.size(), [&a, &b](std::size_t i) {
+			return a[i] * b[i];
+		});
+	}
+
+	// Four independent partial sums so the loop is not bound by the latency of one add.
+	template<class Func>
+	[[nodiscard]] static value_type Reduce(std::size_t size, Func func) {
+		value_type s0{}, s1{}, s2{}, s3{};
+		std::size_t i = 0u;
+
+		for (; i + 4u <= size; i += 4u) {
+			s0 += func(i);
+			s1 += func(i + 1u);
+			s2 += func(i + 2u);
+			s3 += func(i + 3u);
+		}
+
+		for (; i < size; ++i) {
+			s0 += func(i);
+		}
+
+		return (s0 + s1) + (s2 + s3);
+	}
+
+	// Chunk boundaries depend only on the input size, so the merged sums
+	// are the same for any number of threads.
+	[[nodiscard]] std::size_t GetChunkCount() const {
+		return (this->data_.GetRowCount() + MultipleRegressionSolver::CHUNK_SIZE - 1u) / MultipleRegressionSolver::CHUNK_SIZE;
+	}
+
+	template<class Func>
+	void ForEachChunk(std::size_t chunkCount, Func func) const {
+		const auto body = [this, &func](std::size_t chunk) {
+			const auto offset = chunk * MultipleRegressionSolver::CHUNK_SIZE;
+			const auto count = std::min(MultipleRegressionSolver::CHUNK_SIZE, this->data_.GetRowCount() - offset);
+
+			func(chunk, this->data_.GetSubView(offset, count));
+		};
+
+		if (this->options_.threadPool && chunkCount > 1u) {
+			this->options_.threadPool->ParallelFor(chunkCount, body);
+			return;
+		}
+
+		for (std::size_t chunk = 0u; chunk < chunkCount; ++chunk) {
+			body(chunk);
+		}
+	}
+};
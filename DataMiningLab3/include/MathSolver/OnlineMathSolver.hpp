@@ -0,0 +1,106 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+
+#include "CenteredMoments.hpp"
+#include "Point/PointSet.hpp"
+
+// y = a1 * x + a0 over a growing (or shrinking) set of points.
+// Only the centered moments are kept, every update and every getter is O(1).
+template<class T> requires std::is_floating_point_v<T>
+class OnlineMathSolver final {
+private:
+	using value_type = T;
+
+public:
+	OnlineMathSolver() = default;
+
+	explicit OnlineMathSolver(const PointSetView<value_type>& data) {
+		this->AddBatch(data);
+	}
+
+	explicit OnlineMathSolver(const CenteredMoments<value_type>& moments) : moments_(moments) {
+
+	}
+
+	OnlineMathSolver(const OnlineMathSolver&) = default;
+
+	OnlineMathSolver(OnlineMathSolver&&) noexcept = default;
+
+	~OnlineMathSolver() noexcept = default;
+
+	OnlineMathSolver& operator=(const OnlineMathSolver&) = default;
+
+	OnlineMathSolver& operator=(OnlineMathSolver&&) noexcept = default;
+
+	//-------------------- UPDATES ---------------------------------------//
+
+	void Add(value_type x, value_type y) {
+		this->moments_.Add(x, y);
+	}
+
+	void AddBatch(const PointSetView<value_type>& data) {
+		this->moments_.Merge(CenteredMoments<value_type>::FromView(data));
+	}
+
+	void Remove(value_type x, value_type y) {
+		this->moments_.Remove(x, y);
+	}
+
+	//-------------------- GETTERS ---------------------------------------//
+
+	[[nodiscard]] const CenteredMoments<value_type>& GetMoments() const {
+		return this->moments_;
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->moments_.GetCount();
+	}
+
+	[[nodiscard]] int GetK() const {
+		return 1;
+	}
+
+	[[nodiscard]] value_type GetXExpectedValue() const {
+		return this->moments_.GetXExpectedValue();
+	}
+
+	[[nodiscard]] value_type GetYExpectedValue() const {
+		return this->moments_.GetYExpectedValue();
+	}
+
+	[[nodiscard]] value_type GetAlphaOne() const {
+		return this->moments_.GetSumXY() / this->moments_.GetSumXX();
+	}
+
+	[[nodiscard]] value_type GetAlphaZero() const {
+		return this->GetYExpectedValue() - this->GetAlphaOne() * this->GetXExpectedValue();
+	}
+
+	[[nodiscard]] value_type GetSumSquaredRegression() const {
+		return this->moments_.GetSumXY() * this->moments_.GetSumXY() / this->moments_.GetSumXX();
+	}
+
+	// Clamped at zero, rounding can push an exact fit slightly below it.
+	[[nodiscard]] value_type GetSumSquaredError() const {
+		return std::max(this->moments_.GetSumYY() - this->GetSumSquaredRegression(), value_type{});
+	}
+
+	[[nodiscard]] value_type GetDeterminationCoefficient() const {
+		return this->GetSumSquaredRegression() / this->moments_.GetSumYY();
+	}
+
+	//---------------------- MATH -----------------------------------------//
+
+	[[nodiscard]] value_type GetFStatistics() const {
+		const auto k = this->GetK();
+
+		const auto chisl = this->GetSumSquaredRegression() * static_cast<value_type>(this->GetSize() - k - 1);
+		const auto zname = this->GetSumSquaredError() * k;
+
+		return chisl / zname;
+	}
+
+private:
+	CenteredMoments<value_type> moments_;
+};
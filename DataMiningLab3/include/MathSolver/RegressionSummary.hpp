@@ -0,0 +1,128 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "CenteredMoments.hpp"
+#include "Point/PointSet.hpp"
+
+// Fixed 72-byte blob, values in the native byte order like .pts files.
+struct RegressionSummaryHeader {
+	static constexpr std::array<char, 8> MAGIC = { 'D', 'M', 'L', '3', 'S', 'U', 'M', '\0' };
+	static constexpr std::uint32_t VERSION = 1u;
+
+	std::array<char, 8> magic;
+	std::uint32_t version;
+	std::uint32_t reserved;
+	std::uint64_t count;
+	double xExpectedValue;
+	double yExpectedValue;
+	double sumXX;
+	double sumYY;
+	double sumXY;
+	double confidenceProbability;
+};
+
+static_assert(sizeof(RegressionSummaryHeader) == 72u);
+
+// Everything the F-test of y = a1 * x + a0 needs from a shard of points.
+// Summaries merge associatively, so shards can be combined in any grouping.
+class RegressionSummary final {
+public:
+	static constexpr auto* EXTENSION_STR = ".sum";
+
+	RegressionSummary() = default;
+
+	explicit RegressionSummary(const CenteredMoments<double>& moments, double confidenceProbability)
+		: moments_(moments), confidenceProbability_(confidenceProbability) {
+
+	}
+
+	RegressionSummary(const RegressionSummary&) = default;
+
+	RegressionSummary(RegressionSummary&&) noexcept = default;
+
+	~RegressionSummary() noexcept = default;
+
+	RegressionSummary& operator=(const RegressionSummary&) = default;
+
+	RegressionSummary& operator=(RegressionSummary&&) noexcept = default;
+
+	[[nodiscard]] static RegressionSummary FromView(const PointSetView<double>& points, double confidenceProbability) {
+		return RegressionSummary{ CenteredMoments<double>::FromView(points), confidenceProbability };
+	}
+
+	void Merge(const RegressionSummary& other) {
+		if (this->moments_.GetCount() != 0u && other.moments_.GetCount() != 0u &&
+			this->confidenceProbability_ != other.confidenceProbability_) {
+			throw std::runtime_error("Summaries have different confidence probabilities!");
+		}
+
+		if (this->moments_.GetCount() == 0u) {
+			this->confidenceProbability_ = other.confidenceProbability_;
+		}
+
+		this->moments_.Merge(other.moments_);
+	}
+
+	[[nodiscard]] const CenteredMoments<double>& GetMoments() const {
+		return this->moments_;
+	}
+
+	[[nodiscard]] double GetConfidenceProbability() const {
+		return this->confidenceProbability_;
+	}
+
+	void Write(const std::string& path) const {
+		std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("Can't create the output file!");
+		}
+
+		RegressionSummaryHeader header{};
+		header.magic = RegressionSummaryHeader::MAGIC;
+		header.version = RegressionSummaryHeader::VERSION;
+		header.count = this->moments_.GetCount();
+		header.xExpectedValue = this->moments_.GetXExpectedValue();
+		header.yExpectedValue = this->moments_.GetYExpectedValue();
+		header.sumXX = this->moments_.GetSumXX();
+		header.sumYY = this->moments_.GetSumYY();
+		header.sumXY = this->moments_.GetSumXY();
+		header.confidenceProbability = this->confidenceProbability_;
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+		if (!file) {
+			throw std::runtime_error("Can't write the output file!");
+		}
+	}
+
+	[[nodiscard]] static RegressionSummary Read(const std::string& path) {
+		std::ifstream file(path, std::ifstream::binary);
+
+		if (!file.is_open()) {
+			throw std::runtime_error("Wrong path or file doesn't exist!");
+		}
+
+		RegressionSummaryHeader header{};
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+		if (!file || header.magic != RegressionSummaryHeader::MAGIC || header.version != RegressionSummaryHeader::VERSION) {
+			throw std::runtime_error("Wrong summary file format!");
+		}
+
+		const CenteredMoments<double> moments{
+			static_cast<std::size_t>(header.count), header.xExpectedValue, header.yExpectedValue,
+			header.sumXX, header.sumYY, header.sumXY
+		};
+
+		return RegressionSummary{ moments, header.confidenceProbability };
+	}
+
+private:
+	CenteredMoments<double> moments_;
+	double confidenceProbability_{};
+};
@@ -0,0 +1,149 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "CenteredMoments.hpp"
+#include "OnlineMathSolver.hpp"
+#include "SolverOptions.hpp"
+#include "Point/PointSet.hpp"
+
+// y = a1 * x + a0 fitted over every window [offset, offset + window) with offset = 0, stride, 2 * stride, ...
+// Consecutive windows differ by removing and adding stride points, so the whole series costs O(n).
+template<class T> requires std::is_floating_point_v<T>
+class SlidingWindowSolver final {
+private:
+	using value_type = T;
+
+	// Windows per parallel task, each task starts from freshly computed moments.
+	static constexpr std::size_t RANGE_SIZE = 1u << 12u;
+
+	// The moments are recomputed from the window after this many updates per window point,
+	// which bounds the rounding drift of long add/remove sequences at O(1) amortized cost.
+	static constexpr std::size_t REBASE_FACTOR = 8u;
+
+public:
+	struct Window {
+		std::size_t offset{};
+
+		value_type alphaOne{};
+		value_type alphaZero{};
+		value_type fStatistics{};
+	};
+
+	explicit SlidingWindowSolver(PointSetView<value_type> data, std::size_t window, std::size_t stride,
+		const SolverOptions& options = {})
+		: data_(data), window_(window), stride_(stride), options_(options) {
+		if (window < 3u) {
+			throw std::runtime_error("Window must contain at least three points!");
+		}
+
+		if (stride == 0u) {
+			throw std::runtime_error("Stride must be positive!");
+		}
+
+		this->Solve();
+	}
+
+	SlidingWindowSolver(const SlidingWindowSolver&) = delete;
+
+	SlidingWindowSolver(SlidingWindowSolver&&) noexcept = default;
+
+	~SlidingWindowSolver() noexcept = default;
+
+	SlidingWindowSolver& operator=(const SlidingWindowSolver&) = delete;
+
+	SlidingWindowSolver& operator=(SlidingWindowSolver&&) noexcept = default;
+
+	[[nodiscard]] const std::vector<Window>& GetWindows() const {
+		return this->windows_;
+	}
+
+	[[nodiscard]] std::size_t GetWindowSize() const {
+		return this->window_;
+	}
+
+	[[nodiscard]] std::size_t GetStride() const {
+		return this->stride_;
+	}
+
+	[[nodiscard]] int GetK() const {
+		return 1;
+	}
+
+private:
+	PointSetView<value_type> data_;
+	std::size_t window_{};
+	std::size_t stride_{};
+
+	SolverOptions options_;
+
+	std::vector<Window> windows_;
+
+	void Solve() {
+		const auto size = this->data_.GetSize();
+
+		if (size < this->window_) {
+			return;
+		}
+
+		this->windows_.resize((size - this->window_) / this->stride_ + 1u);
+
+		const auto rangeCount = (this->windows_.size() + SlidingWindowSolver::RANGE_SIZE - 1u) / SlidingWindowSolver::RANGE_SIZE;
+
+		const auto body = [this](std::size_t range) {
+			const auto first = range * SlidingWindowSolver::RANGE_SIZE;
+			const auto last = std::min(first + SlidingWindowSolver::RANGE_SIZE, this->windows_.size());
+
+			this->SolveRange(first, last);
+		};
+
+		if (this->options_.threadPool && rangeCount > 1u) {
+			this->options_.threadPool->ParallelFor(rangeCount, body);
+			return;
+		}
+
+		for (std::size_t range = 0u; range < rangeCount; ++range) {
+			body(range);
+		}
+	}
+
+	void SolveRange(std::size_t first, std::size_t last) {
+		const auto x = this->data_.GetX();
+		const auto y = this->data_.GetY();
+
+		// Disjoint windows share no points, sliding would only add work.
+		const auto isSliding = this->stride_ < this->window_;
+		const auto rebaseLimit = SlidingWindowSolver::REBASE_FACTOR * this->window_;
+
+		CenteredMoments<value_type> moments;
+		std::size_t updates = 0u;
+
+		for (auto i = first; i < last; ++i) {
+			const auto offset = i * this->stride_;
+
+			if (i == first || !isSliding || updates >= rebaseLimit) {
+				moments = CenteredMoments<value_type>::FromView(this->data_.GetSubView(offset, this->window_));
+				updates = 0u;
+			}
+			else {
+				const auto previous = offset - this->stride_;
+
+				for (auto j = previous; j < offset; ++j) {
+					moments.Remove(x[j], y[j]);
+				}
+
+				for (auto j = previous + this->window_; j < offset + this->window_; ++j) {
+					moments.Add(x[j], y[j]);
+				}
+
+				updates += 2u * this->stride_;
+			}
+
+			const OnlineMathSolver<value_type> solver{ moments };
+
+			this->windows_[i] = Window{ offset, solver.GetAlphaOne(), solver.GetAlphaZero(), solver.GetFStatistics() };
+		}
+	}
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include <memory>
+
+#include "MomentKernels.hpp"
+#include "ThreadPool/ThreadPool.hpp"
+
+// Storage and accumulation types of MathSolver: float, float points with double sums, double, long double.
+enum class Precision {
+	Float,
+	Mixed,
+	Double,
+	LongDouble
+};
+
+struct SolverOptions {
+	Summation summation = Summation::Naive;
+	Precision precision = Precision::Double;
+	std::shared_ptr<ThreadPool> threadPool;
+};
@@ -0,0 +1,153 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "PointSet.hpp"
+
+// Column-major n x k regressor matrix with the response column alongside.
+// Column j starts at values + j * stride, so sub-views of consecutive rows need no copy.
+template<class T>
+class DesignMatrixView {
+private:
+	using value_type = T;
+
+public:
+	DesignMatrixView() = default;
+
+	explicit DesignMatrixView(const value_type* values, std::size_t rows, std::size_t columns, std::size_t stride,
+		std::span<const value_type> y)
+		: values_(values), rows_(rows), columns_(columns), stride_(stride), y_(y) {
+
+	}
+
+	// A point set is the k = 1 matrix.
+	explicit DesignMatrixView(const PointSetView<value_type>& points)
+		: DesignMatrixView(points.GetX().data(), points.GetSize(), 1u, points.GetSize(), points.GetY()) {
+
+	}
+
+	[[nodiscard]] std::span<const value_type> GetColumn(std::size_t j) const {
+		return std::span<const value_type>{ this->values_ + j * this->stride_, this->rows_ };
+	}
+
+	[[nodiscard]] std::span<const value_type> GetY() const {
+		return this->y_;
+	}
+
+	[[nodiscard]] std::size_t GetRowCount() const {
+		return this->rows_;
+	}
+
+	[[nodiscard]] std::size_t GetColumnCount() const {
+		return this->columns_;
+	}
+
+	[[nodiscard]] DesignMatrixView GetSubView(std::size_t offset, std::size_t count) const {
+		return DesignMatrixView{ this->values_ + offset, count, this->columns_, this->stride_, this->y_.subspan(offset, count) };
+	}
+
+	[[nodiscard]] PointSetView<value_type> GetPoints() const {
+		if (this->columns_ != 1u) {
+			throw std::runtime_error("Data has more than one regressor!");
+		}
+
+		return PointSetView<value_type>{ this->GetColumn(0u), this->y_ };
+	}
+
+private:
+	const value_type* values_{};
+	std::size_t rows_{};
+	std::size_t columns_{};
+	std::size_t stride_{};
+
+	std::span<const value_type> y_;
+};
+
+template<class T>
+class DesignMatrix {
+private:
+	using value_type = T;
+
+	static constexpr std::size_t ALIGNMENT = 64u;
+	static constexpr std::size_t MIN_CAPACITY = 1024u;
+
+	using container_type = std::vector<value_type, AlignedAllocator<value_type, DesignMatrix::ALIGNMENT>>;
+
+public:
+	explicit DesignMatrix(std::size_t columns) : columns_(columns) {
+
+	}
+
+	DesignMatrix(const DesignMatrix&) = default;
+
+	DesignMatrix(DesignMatrix&&) noexcept = default;
+
+	~DesignMatrix() noexcept = default;
+
+	DesignMatrix& operator=(const DesignMatrix&) = default;
+
+	DesignMatrix& operator=(DesignMatrix&&) noexcept = default;
+
+	void Reserve(std::size_t rows) {
+		if (rows > this->capacity_) {
+			this->Reallocate(rows);
+		}
+
+		this->y_.reserve(rows);
+	}
+
+	void Add(std::span<const value_type> row, value_type y) {
+		if (row.size() != this->columns_) {
+			throw std::runtime_error("Every row must contain the same number of regressors!");
+		}
+
+		if (this->rows_ == this->capacity_) {
+			this->Reallocate(std::max(DesignMatrix::MIN_CAPACITY, 2u * this->capacity_));
+		}
+
+		for (std::size_t j = 0u; j < this->columns_; ++j) {
+			this->values_[j * this->capacity_ + this->rows_] = row[j];
+		}
+
+		this->y_.push_back(y);
+		++this->rows_;
+	}
+
+	[[nodiscard]] std::size_t GetRowCount() const {
+		return this->rows_;
+	}
+
+	[[nodiscard]] std::size_t GetColumnCount() const {
+		return this->columns_;
+	}
+
+	[[nodiscard]] DesignMatrixView<value_type> GetView() const {
+		return DesignMatrixView<value_type>{ this->values_.data(), this->rows_, this->columns_, this->capacity_, this->y_ };
+	}
+
+private:
+	std::size_t columns_{};
+	std::size_t rows_{};
+	std::size_t capacity_{};
+
+	container_type values_;
+	container_type y_;
+
+	// Columns are laid out capacity_ apart, growing moves each column to its new offset.
+	void Reallocate(std::size_t capacity) {
+		container_type values(this->columns_ * capacity);
+
+		for (std::size_t j = 0u; j < this->columns_; ++j) {
+			const auto begin = this->values_.begin() + static_cast<std::ptrdiff_t>(j * this->capacity_);
+
+			std::copy(begin, begin + static_cast<std::ptrdiff_t>(this->rows_),
+				values.begin() + static_cast<std::ptrdiff_t>(j * capacity));
+		}
+
+		this->values_ = std::move(values);
+		this->capacity_ = capacity;
+	}
+};
@@ -15,7 +15,7 @@ public:
 
 	Point(Point&&) noexcept = default;
 
-	virtual ~Point() noexcept = default;
+	~Point() noexcept = default;
 
 	Point& operator=(const Point&) = default;
 
@@ -0,0 +1,247 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <span>
+#include <vector>
+
+#include "Point.hpp"
+
+template<class T, std::size_t Alignment>
+struct AlignedAllocator {
+	using value_type = T;
+	using is_always_equal = std::true_type;
+
+	template<class U>
+	struct rebind {
+		using other = AlignedAllocator<U, Alignment>;
+	};
+
+	AlignedAllocator() noexcept = default;
+
+	template<class U>
+	AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}
+
+	[[nodiscard]] T* allocate(std::size_t count) {
+		return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{ Alignment }));
+	}
+
+	void deallocate(T* pointer, std::size_t) noexcept {
+		::operator delete(pointer, std::align_val_t{ Alignment });
+	}
+
+	template<class U>
+	bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept {
+		return true;
+	}
+};
+
+template<class T>
+class PointSetChunks;
+
+template<class T>
+class PointSetView {
+private:
+	using value_type = T;
+
+public:
+	PointSetView() = default;
+
+	explicit PointSetView(std::span<const value_type> x, std::span<const value_type> y)
+		: x_(x), y_(y) {
+
+	}
+
+	[[nodiscard]] std::span<const value_type> GetX() const {
+		return this->x_;
+	}
+
+	[[nodiscard]] std::span<const value_type> GetY() const {
+		return this->y_;
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->x_.size();
+	}
+
+	[[nodiscard]] bool IsEmpty() const {
+		return this->x_.empty();
+	}
+
+	[[nodiscard]] Point<value_type> GetPoint(std::size_t i) const {
+		return Point<value_type>{ this->x_[i], this->y_[i] };
+	}
+
+	[[nodiscard]] PointSetView GetSubView(std::size_t offset, std::size_t count) const {
+		return PointSetView{ this->x_.subspan(offset, count), this->y_.subspan(offset, count) };
+	}
+
+	[[nodiscard]] PointSetChunks<value_type> GetChunks(std::size_t chunkSize) const;
+
+private:
+	std::span<const value_type> x_;
+	std::span<const value_type> y_;
+};
+
+template<class T>
+class PointSetChunks {
+private:
+	using value_type = T;
+
+public:
+	class Iterator {
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using value_type = PointSetView<T>;
+		using difference_type = std::ptrdiff_t;
+
+		Iterator() = default;
+
+		explicit Iterator(PointSetView<T> view, std::size_t chunkSize, std::size_t offset)
+			: view_(view), chunkSize_(chunkSize), offset_(offset) {
+
+		}
+
+		[[nodiscard]] PointSetView<T> operator*() const {
+			return this->view_.GetSubView(this->offset_, std::min(this->chunkSize_, this->view_.GetSize() - this->offset_));
+		}
+
+		Iterator& operator++() {
+			this->offset_ = std::min(this->offset_ + this->chunkSize_, this->view_.GetSize());
+			return *this;
+		}
+
+		Iterator operator++(int) {
+			auto result = *this;
+			++*this;
+			return result;
+		}
+
+		[[nodiscard]] bool operator==(const Iterator& other) const {
+			return this->offset_ == other.offset_;
+		}
+
+	private:
+		PointSetView<T> view_;
+		std::size_t chunkSize_{};
+		std::size_t offset_{};
+	};
+
+	explicit PointSetChunks(PointSetView<value_type> view, std::size_t chunkSize)
+		: view_(view), chunkSize_(std::max<std::size_t>(chunkSize, 1u)) {
+
+	}
+
+	[[nodiscard]] Iterator begin() const {
+		return Iterator{ this->view_, this->chunkSize_, 0u };
+	}
+
+	[[nodiscard]] Iterator end() const {
+		return Iterator{ this->view_, this->chunkSize_, this->view_.GetSize() };
+	}
+
+	[[nodiscard]] std::size_t size() const {
+		return (this->view_.GetSize() + this->chunkSize_ - 1u) / this->chunkSize_;
+	}
+
+private:
+	PointSetView<value_type> view_;
+	std::size_t chunkSize_{};
+};
+
+template<class T>
+PointSetChunks<T> PointSetView<T>::GetChunks(std::size_t chunkSize) const {
+	return PointSetChunks<T>{ *this, chunkSize };
+}
+
+template<class T>
+class PointSet {
+private:
+	using value_type = T;
+
+	static constexpr std::size_t ALIGNMENT = 64u;
+
+	using container_type = std::vector<value_type, AlignedAllocator<value_type, PointSet::ALIGNMENT>>;
+
+public:
+	PointSet() = default;
+
+	explicit PointSet(std::size_t size) : x_(size), y_(size) {
+
+	}
+
+	template<class Iter>
+	explicit PointSet(Iter begin, Iter end) {
+		this->Reserve(static_cast<std::size_t>(std::distance(begin, end)));
+
+		std::for_each(begin, end, [this](const Point<value_type>& point) {
+			this->Add(point.x(), point.y());
+		});
+	}
+
+	PointSet(std::initializer_list<Point<value_type>> points)
+		: PointSet(points.begin(), points.end()) {
+
+	}
+
+	// Converts the coordinates when U is not T, e.g. double points into float storage.
+	template<class U>
+	explicit PointSet(const PointSetView<U>& view)
+		: x_(view.GetX().begin(), view.GetX().end()), y_(view.GetY().begin(), view.GetY().end()) {
+
+	}
+
+	PointSet(const PointSet&) = default;
+
+	PointSet(PointSet&&) noexcept = default;
+
+	~PointSet() noexcept = default;
+
+	PointSet& operator=(const PointSet&) = default;
+
+	PointSet& operator=(PointSet&&) noexcept = default;
+
+	void Reserve(std::size_t size) {
+		this->x_.reserve(size);
+		this->y_.reserve(size);
+	}
+
+	void Add(value_type x, value_type y) {
+		this->x_.push_back(x);
+		this->y_.push_back(y);
+	}
+
+	[[nodiscard]] std::span<const value_type> GetX() const {
+		return this->x_;
+	}
+
+	[[nodiscard]] std::span<const value_type> GetY() const {
+		return this->y_;
+	}
+
+	[[nodiscard]] std::span<value_type> GetX() {
+		return this->x_;
+	}
+
+	[[nodiscard]] std::span<value_type> GetY() {
+		return this->y_;
+	}
+
+	[[nodiscard]] std::size_t GetSize() const {
+		return this->x_.size();
+	}
+
+	[[nodiscard]] bool IsEmpty() const {
+		return this->x_.empty();
+	}
+
+	[[nodiscard]] PointSetView<value_type> GetView() const {
+		return PointSetView<value_type>{ this->x_, this->y_ };
+	}
+
+private:
+	container_type x_;
+	container_type y_;
+};
@@ -0,0 +1,286 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Streaming renderer for a header row, numeric rows stored column by column and text footer rows.
+// The output is the same ASCII grid tabulate printed with its default format, but the widths come
+// from the column extremes and the rows are written straight into a buffer, without per-cell objects.
+template<class T> requires std::is_floating_point_v<T>
+class NumericTable final {
+private:
+	using value_type = T;
+
+	static constexpr int NUMBER_PRECISION = 4;
+
+	// Sign, every integer digit of the largest finite value, the point and the decimals.
+	static constexpr std::size_t NUMBER_SIZE =
+		std::numeric_limits<value_type>::max_exponent10 + NumericTable::NUMBER_PRECISION + 4u;
+
+	static constexpr std::size_t INDEX_SIZE = std::numeric_limits<std::size_t>::digits10 + 1u;
+
+	// The buffer is handed to the stream once it grows past this size.
+	static constexpr std::size_t FLUSH_SIZE = 1u << 16u;
+
+public:
+	explicit NumericTable(std::vector<std::string> header) : header_(std::move(header)) {
+
+	}
+
+	NumericTable(const NumericTable&) = default;
+
+	NumericTable(NumericTable&&) noexcept = default;
+
+	~NumericTable() noexcept = default;
+
+	NumericTable& operator=(const NumericTable&) = default;
+
+	NumericTable& operator=(NumericTable&&) noexcept = default;
+
+	// The 1-based row number.
+	void AddIndexColumn() {
+		this->columns_.push_back(Column{ true, true, {}, {} });
+	}
+
+	// The 1-based numbers of the given 0-based rows, which need not be consecutive.
+	void AddIndexColumn(std::vector<std::size_t> rows) {
+		this->columns_.push_back(Column{ true, false, {}, std::move(rows) });
+	}
+
+	// Values printed with four decimals.
+	void AddColumn(std::vector<value_type> values) {
+		this->columns_.push_back(Column{ false, false, std::move(values), {} });
+	}
+
+	void AddFooter(std::vector<std::string> footer) {
+		this->footers_.push_back(std::move(footer));
+	}
+
+	[[nodiscard]] std::size_t GetRowCount() const {
+		const auto column = std::find_if(this->columns_.begin(), this->columns_.end(), [](const Column& column) {
+			return !column.isConsecutive;
+		});
+
+		return column == this->columns_.end() ? 0u : column->GetSize();
+	}
+
+	void Print(std::ostream& out) const {
+		this->Validate();
+
+		const auto widths = this->GetWidths();
+		const auto rowCount = this->GetRowCount();
+
+		std::string buffer;
+		buffer.reserve(NumericTable::FLUSH_SIZE + 1024u);
+
+		NumericTable::AppendBorder(buffer, widths);
+		buffer += '\n';
+		NumericTable::AppendTextRow(buffer, this->header_, widths);
+
+		for (std::size_t i = 0u; i < rowCount; ++i) {
+			buffer += '\n';
+			NumericTable::AppendBorder(buffer, widths);
+			buffer += '\n';
+			this->AppendNumericRow(buffer, i, widths);
+
+			if (buffer.size() >= NumericTable::FLUSH_SIZE) {
+				out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+				buffer.clear();
+			}
+		}
+
+		for (const auto& footer : this->footers_) {
+			buffer += '\n';
+			NumericTable::AppendBorder(buffer, widths);
+			buffer += '\n';
+			NumericTable::AppendTextRow(buffer, footer, widths);
+		}
+
+		buffer += '\n';
+		NumericTable::AppendBorder(buffer, widths);
+
+		out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	}
+
+	friend std::ostream& operator<<(std::ostream& out, const NumericTable& table) {
+		table.Print(out);
+		return out;
+	}
+
+private:
+	struct Column {
+		bool isIndex{};
+		bool isConsecutive{};
+		std::vector<value_type> values;
+		std::vector<std::size_t> rows;
+
+		[[nodiscard]] std::size_t GetSize() const {
+			return this->isIndex ? this->rows.size() : this->values.size();
+		}
+	};
+
+	std::vector<std::string> header_;
+	std::vector<Column> columns_;
+	std::vector<std::vector<std::string>> footers_;
+
+	void Validate() const {
+		const auto rowCount = this->GetRowCount();
+
+		const auto isValid = this->header_.size() == this->columns_.size() &&
+			std::all_of(this->columns_.begin(), this->columns_.end(), [rowCount](const Column& column) {
+				return column.isConsecutive || column.GetSize() == rowCount;
+			}) &&
+			std::all_of(this->footers_.begin(), this->footers_.end(), [this](const std::vector<std::string>& footer) {
+				return footer.size() == this->columns_.size();
+			});
+
+		if (!isValid) {
+			throw std::runtime_error("Table rows have different sizes!");
+		}
+	}
+
+	// Rounding and the digit count of the integer part grow with |x|, so the widest cell of a column
+	// is its largest non-negative value or its largest negative one (one sign wider).
+	[[nodiscard]] std::vector<std::size_t> GetWidths() const {
+		std::vector<std::size_t> widths(this->columns_.size());
+
+		for (std::size_t j = 0u; j < this->columns_.size(); ++j) {
+			const auto& column = this->columns_[j];
+
+			auto width = this->header_[j].size();
+
+			for (const auto& footer : this->footers_) {
+				width = std::max(width, footer[j].size());
+			}
+
+			if (column.isConsecutive) {
+				width = std::max(width, NumericTable::GetIndexWidth(this->GetRowCount()));
+			}
+			else if (column.isIndex && !column.rows.empty()) {
+				const auto last = *std::max_element(column.rows.begin(), column.rows.end());
+				width = std::max(width, NumericTable::GetIndexWidth(last + 1u));
+			}
+			else if (!column.values.empty()) {
+				width = std::max(width, NumericTable::GetNumberWidth(column.values));
+			}
+
+			widths[j] = width + 2u;
+		}
+
+		return widths;
+	}
+
+	[[nodiscard]] static std::size_t GetNumberWidth(const std::vector<value_type>& values) {
+		value_type positiveMax{}, negativeMax{};
+		bool hasPositive = false, hasNegative = false;
+
+		std::size_t width = 0u;
+
+		for (const auto value : values) {
+			if (!std::isfinite(value)) {
+				width = std::max(width, NumericTable::GetNumberWidth(value));
+				continue;
+			}
+
+			if (std::signbit(value)) {
+				negativeMax = std::min(negativeMax, value);
+				hasNegative = true;
+				continue;
+			}
+
+			positiveMax = std::max(positiveMax, value);
+			hasPositive = true;
+		}
+
+		if (hasPositive) {
+			width = std::max(width, NumericTable::GetNumberWidth(positiveMax));
+		}
+
+		if (hasNegative) {
+			// negativeMax may still be the +0 it started from when every negative value is -0.
+			width = std::max(width, NumericTable::GetNumberWidth(-std::abs(negativeMax)));
+		}
+
+		return width;
+	}
+
+	// std::to_chars gives the same text as "{:.4f}" and "{}" in std::format, without a locale or a temporary string.
+	[[nodiscard]] static std::size_t GetNumberWidth(value_type value) {
+		char number[NumericTable::NUMBER_SIZE];
+		const auto result = std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, NumericTable::NUMBER_PRECISION);
+
+		return static_cast<std::size_t>(result.ptr - number);
+	}
+
+	[[nodiscard]] static std::size_t GetIndexWidth(std::size_t index) {
+		char number[NumericTable::INDEX_SIZE];
+		const auto result = std::to_chars(number, number + sizeof(number), index);
+
+		return static_cast<std::size_t>(result.ptr - number);
+	}
+
+	static void AppendNumber(std::string& buffer, value_type value) {
+		char number[NumericTable::NUMBER_SIZE];
+		const auto result = std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, NumericTable::NUMBER_PRECISION);
+
+		buffer.append(number, result.ptr);
+	}
+
+	static void AppendIndex(std::string& buffer, std::size_t index) {
+		char number[NumericTable::INDEX_SIZE];
+		const auto result = std::to_chars(number, number + sizeof(number), index);
+
+		buffer.append(number, result.ptr);
+	}
+
+	static void AppendBorder(std::string& buffer, const std::vector<std::size_t>& widths) {
+		for (const auto width : widths) {
+			buffer += '+';
+			buffer.append(width, '-');
+		}
+
+		buffer += '+';
+	}
+
+	static void AppendCell(std::string& buffer, std::size_t begin, std::size_t width) {
+		buffer.append(width - 1u - (buffer.size() - begin), ' ');
+	}
+
+	static void AppendTextRow(std::string& buffer, const std::vector<std::string>& row, const std::vector<std::size_t>& widths) {
+		for (std::size_t j = 0u; j < row.size(); ++j) {
+			buffer += "| ";
+
+			const auto begin = buffer.size();
+			buffer += row[j];
+
+			NumericTable::AppendCell(buffer, begin, widths[j]);
+		}
+
+		buffer += '|';
+	}
+
+	void AppendNumericRow(std::string& buffer, std::size_t i, const std::vector<std::size_t>& widths) const {
+		for (std::size_t j = 0u; j < this->columns_.size(); ++j) {
+			buffer += "| ";
+
+			const auto begin = buffer.size();
+
+			if (this->columns_[j].isIndex) {
+				NumericTable::AppendIndex(buffer, this->columns_[j].isConsecutive ? i + 1u : this->columns_[j].rows[i] + 1u);
+			}
+			else {
+				NumericTable::AppendNumber(buffer, this->columns_[j].values[i]);
+			}
+
+			NumericTable::AppendCell(buffer, begin, widths[j]);
+		}
+
+		buffer += '|';
+	}
+};
@@ -0,0 +1,122 @@
+#pragma once
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+enum class RowMode {
+	All,
+	None,
+	Head,
+	Tail,
+	Sample
+};
+
+// Which rows of the per-point table are shown: all, none, head:N, tail:N or sample:N.
+// A sample takes N evenly spaced rows, so it is the same from run to run.
+class RowSelection final {
+private:
+	static constexpr char COUNT_SEPARATOR = ':';
+
+public:
+	RowSelection() = default;
+
+	explicit RowSelection(RowMode mode, std::size_t count = 0u) : mode_(mode), count_(count) {
+
+	}
+
+	RowSelection(const RowSelection&) = default;
+
+	RowSelection(RowSelection&&) noexcept = default;
+
+	~RowSelection() noexcept = default;
+
+	RowSelection& operator=(const RowSelection&) = default;
+
+	RowSelection& operator=(RowSelection&&) noexcept = default;
+
+	[[nodiscard]] static RowSelection Parse(std::string_view text) {
+		if (text == "all") {
+			return RowSelection{ RowMode::All };
+		}
+
+		if (text == "none") {
+			return RowSelection{ RowMode::None };
+		}
+
+		const auto separator = text.find(RowSelection::COUNT_SEPARATOR);
+
+		if (separator == std::string_view::npos) {
+			throw std::runtime_error("Unknown row mode!");
+		}
+
+		const auto name = text.substr(0u, separator);
+		const auto count = RowSelection::ParseCount(text.substr(separator + 1u));
+
+		if (name == "head") {
+			return RowSelection{ RowMode::Head, count };
+		}
+
+		if (name == "tail") {
+			return RowSelection{ RowMode::Tail, count };
+		}
+
+		if (name == "sample") {
+			return RowSelection{ RowMode::Sample, count };
+		}
+
+		throw std::runtime_error("Unknown row mode!");
+	}
+
+	[[nodiscard]] RowMode GetMode() const {
+		return this->mode_;
+	}
+
+	[[nodiscard]] std::size_t GetCount() const {
+		return this->count_;
+	}
+
+	// Ascending indices of the shown rows out of rowCount.
+	[[nodiscard]] std::vector<std::size_t> GetRows(std::size_t rowCount) const {
+		const auto count = this->mode_ == RowMode::All ? rowCount
+			: this->mode_ == RowMode::None ? 0u
+			: std::min(this->count_, rowCount);
+
+		std::vector<std::size_t> rows(count);
+
+		switch (this->mode_) {
+		case RowMode::Tail:
+			std::iota(rows.begin(), rows.end(), rowCount - count);
+			break;
+		case RowMode::Sample:
+			// i * rowCount / count without overflowing the product.
+			for (std::size_t i = 0u; i < count; ++i) {
+				rows[i] = i * (rowCount / count) + i * (rowCount % count) / count;
+			}
+			break;
+		default:
+			std::iota(rows.begin(), rows.end(), std::size_t{ 0u });
+			break;
+		}
+
+		return rows;
+	}
+
+private:
+	RowMode mode_{ RowMode::All };
+	std::size_t count_{};
+
+	[[nodiscard]] static std::size_t ParseCount(std::string_view text) {
+		std::size_t value{};
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+
+		if (error != std::errc{} || end != text.data() + text.size() || text.empty()) {
+			throw std::runtime_error("Wrong row count!");
+		}
+
+		return value;
+	}
+};
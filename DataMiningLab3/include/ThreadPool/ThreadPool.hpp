@@ -0,0 +1,183 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class ThreadPool final {
+public:
+	explicit ThreadPool(unsigned threadCount) {
+		threadCount = std::max(threadCount, 1u);
+
+		this->workers_.reserve(threadCount);
+
+		for (auto i = 0u; i < threadCount; ++i) {
+			this->workers_.emplace_back([this] {
+				this->WorkerLoop();
+			});
+		}
+	}
+
+	ThreadPool(const ThreadPool&) = delete;
+
+	ThreadPool(ThreadPool&&) = delete;
+
+	~ThreadPool() noexcept {
+		{
+			std::scoped_lock lock(this->mutex_);
+			this->isStopped_ = true;
+		}
+
+		this->condition_.notify_all();
+
+		for (auto& worker : this->workers_) {
+			worker.join();
+		}
+	}
+
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	ThreadPool& operator=(ThreadPool&&) = delete;
+
+	[[nodiscard]] unsigned GetThreadCount() const {
+		return static_cast<unsigned>(this->workers_.size());
+	}
+
+	template<class Func>
+	[[nodiscard]] std::future<std::invoke_result_t<Func>> Submit(Func func) {
+		auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Func>()>>(std::move(func));
+		auto future = task->get_future();
+
+		this->Enqueue([task] {
+			(*task)();
+		});
+
+		return future;
+	}
+
+	// Calls func(i) for every i in [0, count). The calling thread takes part in the loop,
+	// so it is safe to call this from inside a task that already runs on the pool.
+	template<class Func>
+	void ParallelFor(std::size_t count, Func func) {
+		if (count == 0u) {
+			return;
+		}
+
+		const auto state = std::make_shared<ParallelForState>();
+		state->count = count;
+		state->func = [&func](std::size_t i) {
+			func(i);
+		};
+
+		const auto helpers = std::min<std::size_t>(this->workers_.size() - 1u, count - 1u);
+
+		for (std::size_t i = 0u; i < helpers; ++i) {
+			this->Enqueue([state] {
+				{
+					std::scoped_lock lock(state->mutex);
+
+					if (state->isClosed) {
+						return;
+					}
+
+					++state->active;
+				}
+
+				state->Run();
+
+				{
+					std::scoped_lock lock(state->mutex);
+					--state->active;
+				}
+
+				state->condition.notify_all();
+			});
+		}
+
+		state->Run();
+
+		std::unique_lock lock(state->mutex);
+		state->isClosed = true;
+		state->condition.wait(lock, [&state] {
+			return state->active == 0u;
+		});
+
+		if (state->exception) {
+			std::rethrow_exception(state->exception);
+		}
+	}
+
+private:
+	struct ParallelForState {
+		std::atomic<std::size_t> next{ 0u };
+		std::size_t count{};
+		std::function<void(std::size_t)> func;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		std::size_t active{};
+		bool isClosed{};
+		std::exception_ptr exception;
+
+		void Run() {
+			for (auto i = this->next++; i < this->count; i = this->next++) {
+				try {
+					this->func(i);
+				}
+				catch (...) {
+					std::scoped_lock lock(this->mutex);
+
+					if (!this->exception) {
+						this->exception = std::current_exception();
+					}
+				}
+			}
+		}
+	};
+
+	std::vector<std::thread> workers_;
+	std::deque<std::function<void()>> tasks_;
+
+	std::mutex mutex_;
+	std::condition_variable condition_;
+	bool isStopped_{};
+
+	void Enqueue(std::function<void()> task) {
+		{
+			std::scoped_lock lock(this->mutex_);
+			this->tasks_.push_back(std::move(task));
+		}
+
+		this->condition_.notify_one();
+	}
+
+	void WorkerLoop() {
+		while (true) {
+			std::function<void()> task;
+
+			{
+				std::unique_lock lock(this->mutex_);
+				this->condition_.wait(lock, [this] {
+					return this->isStopped_ || !this->tasks_.empty();
+				});
+
+				if (this->isStopped_ && this->tasks_.empty()) {
+					return;
+				}
+
+				task = std::move(this->tasks_.front());
+				this->tasks_.pop_front();
+			}
+
+			task();
+		}
+	}
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <source_location>
+#include <string_view>
+
+// Minimal assertions for the test executables: failures are printed and counted,
+// main returns Check::GetResult() so CTest sees the outcome.
+class Check final {
+public:
+	Check() = delete;
+
+	static void That(bool condition, std::string_view what,
+		const std::source_location& location = std::source_location::current()) {
+		if (!condition) {
+			Check::Fail(what, location);
+		}
+	}
+
+	// The error is relative to max(|expected|, 1), so values near zero are compared absolutely.
+	static void Near(long double actual, long double expected, long double relativeTolerance, std::string_view what,
+		const std::source_location& location = std::source_location::current()) {
+		const auto error = std::fabs(actual - expected) / std::max(std::fabs(expected), 1.0L);
+
+		if (!(error <= relativeTolerance)) {
+			std::cerr << "  actual " << static_cast<double>(actual) << ", expected " << static_cast<double>(expected)
+				<< ", relative error " << static_cast<double>(error) << '\n';
+			Check::Fail(what, location);
+		}
+	}
+
+	[[nodiscard]] static int GetResult() {
+		if (Check::failures_ != 0) {
+			std::cerr << Check::failures_ << " check(s) failed\n";
+			return EXIT_FAILURE;
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+private:
+	static inline int failures_ = 0;
+
+	static void Fail(std::string_view what, const std::source_location& location) {
+		std::cerr << location.file_name() << ':' << location.line() << ": " << what << '\n';
+		++Check::failures_;
+	}
+};
@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Check.hpp"
+#include "DataGetter/BinaryDataGetter.hpp"
+#include "DataGetter/CsvDataGetter.hpp"
+
+//-------------------- HELPERS --------------------------------------------//
+
+static std::string GetTempPath(const std::string& name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static void WriteFile(const std::string& path, const BinaryPointsHeader& header, std::size_t payloadSize) {
+	std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+
+	const std::vector<char> payload(payloadSize, '\0');
+
+	file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+}
+
+static bool IsRejected(const std::string& path) {
+	try {
+		const BinaryDataGetter dataGetter(path);
+	}
+	catch (const std::runtime_error&) {
+		return true;
+	}
+
+	return false;
+}
+
+//-------------------- TESTS ----------------------------------------------//
+
+static void TestBinaryRoundTrip() {
+	const auto path = GetTempPath("DataGetterTests_round_trip.pts");
+
+	const PointSet<double> points{ Point<double>{ 1.0, 2.0 }, Point<double>{ 3.0, 5.0 }, Point<double>{ 4.0, 7.5 } };
+	BinaryDataGetter::Write(path, points.GetView(), 0.95);
+
+	{
+		const BinaryDataGetter dataGetter(path);
+		const auto view = dataGetter.GetView();
+
+		Check::That(view.GetSize() == 3u, "wrong point count after the round trip");
+		Check::That(view.GetX()[2] == 4.0 && view.GetY()[2] == 7.5, "wrong points after the round trip");
+		Check::That(dataGetter.GetConfidenceProbability() == 0.95, "wrong probability after the round trip");
+	}
+
+	std::filesystem::remove(path);
+}
+
+// count * valueSize and offset + size must not wrap around 2^64 and pass the bounds check.
+static void TestBinaryHeaderOverflowIsRejected() {
+	const auto path = GetTempPath("DataGetterTests_overflow.pts");
+
+	BinaryPointsHeader header{};
+	header.magic = BinaryPointsHeader::MAGIC;
+	header.version = BinaryPointsHeader::VERSION;
+	header.dtype = BinaryPointsHeader::DTYPE_FLOAT64;
+	header.confidenceProbability = 0.95;
+	header.xOffset = 64u;
+	header.yOffset = 64u;
+
+	// 2^61 * 8 wraps to 0.
+	header.count = std::uint64_t{ 1u } << 61u;
+	WriteFile(path, header, 64u);
+	Check::That(IsRejected(path), "count * valueSize overflow was accepted");
+
+	// offset + 8 wraps to 0.
+	header.count = 1u;
+	header.yOffset = ~std::uint64_t{ 0u } - 7u;
+	WriteFile(path, header, 64u);
+	Check::That(IsRejected(path), "offset + columnSize overflow was accepted");
+
+	// One value past the end of the file.
+	header.count = 9u;
+	header.yOffset = 64u;
+	WriteFile(path, header, 64u);
+	Check::That(IsRejected(path), "truncated column was accepted");
+
+	std::filesystem::remove(path);
+}
+
+// Columns by header name, quoted fields, CRLF line ends, blank lines and no final newline.
+static void TestCsvColumnsByName() {
+	const auto path = GetTempPath("DataGetterTests_columns.csv");
+
+	{
+		std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+		file << "id,\"y\",x\r\n1,2.5,\"10\"\r\n\r\n2,-3e1,20\r\n3,+4,30";
+	}
+
+	CsvOptions options;
+	options.xColumn = "x";
+	options.yColumn = "y";
+	options.confidenceProbability = 0.9;
+
+	{
+		const CsvDataGetter dataGetter(path, options);
+		const auto view = dataGetter.GetView();
+
+		Check::That(view.GetSize() == 3u, "wrong CSV point count");
+		Check::That(view.GetX()[0] == 10.0 && view.GetX()[2] == 30.0, "wrong CSV x column");
+		Check::That(view.GetY()[0] == 2.5 && view.GetY()[1] == -30.0 && view.GetY()[2] == 4.0, "wrong CSV y column");
+	}
+
+	std::filesystem::remove(path);
+}
+
+int main() {
+	TestBinaryRoundTrip();
+	TestBinaryHeaderOverflowIsRejected();
+	TestCsvColumnsByName();
+
+	return Check::GetResult();
+}
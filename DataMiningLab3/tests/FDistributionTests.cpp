@@ -0,0 +1,122 @@
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <numbers>
+#include <string>
+
+#include "Check.hpp"
+#include "FisherF/FDistribution.hpp"
+#include "FisherF/FisherF.hpp"
+
+static constexpr long double TOLERANCE = 1e-12L;
+
+static constexpr std::array<double, 9> ALPHAS = { 1e-6, 1e-3, 0.01, 0.025, 0.05, 0.10, 0.25, 0.5, 0.99 };
+static constexpr std::array<double, 14> DEGREES = { 1.0, 2.0, 3.0, 5.0, 10.0, 30.0, 100.0, 1e3, 1e4, 1e5, 1e6, 1e7, 1e9, 1e10 };
+
+//-------------------- HELPERS --------------------------------------------//
+
+// F(1, 1) is the square of a standard Cauchy variable.
+static long double GetReference11(long double alpha) {
+	const auto t = std::tan(std::numbers::pi_v<long double> * (1.0L - alpha) / 2.0L);
+	return t * t;
+}
+
+// P(F(2, k2) > x) = (1 + 2 x / k2)^(-k2 / 2).
+static long double GetReference2K(long double alpha, long double k2) {
+	return k2 / 2.0L * std::expm1(-2.0L / k2 * std::log(alpha));
+}
+
+// P(F(k1, 2) <= x) = (k1 x / (k1 x + 2))^(k1 / 2).
+static long double GetReferenceK2(long double alpha, long double k1) {
+	const auto exponent = 2.0L / k1 * std::log1p(-alpha);
+	return 2.0L * std::exp(exponent) / (k1 * -std::expm1(exponent));
+}
+
+static std::string Describe(const char* what, double value, double k) {
+	char buffer[128];
+	std::snprintf(buffer, sizeof(buffer), "%s %g, k %g", what, value, k);
+
+	return buffer;
+}
+
+//-------------------- TESTS ----------------------------------------------//
+
+static void TestUpperQuantile11() {
+	const FDistribution distribution(1.0, 1.0);
+
+	for (const auto alpha : ALPHAS) {
+		Check::Near(distribution.GetUpperQuantile(alpha) / GetReference11(alpha), 1.0L, TOLERANCE,
+			Describe("F(1, 1) at alpha", alpha, 1.0));
+	}
+}
+
+// k2 = 1e9 lost 2e-8 of the critical value to cancellation in the complement continued fraction.
+static void TestUpperQuantile2K() {
+	for (const auto k2 : DEGREES) {
+		const FDistribution distribution(2.0, k2);
+
+		for (const auto alpha : ALPHAS) {
+			Check::Near(distribution.GetUpperQuantile(alpha) / GetReference2K(alpha, k2), 1.0L, TOLERANCE,
+				Describe("F(2, k) at alpha", alpha, k2));
+		}
+	}
+}
+
+// k1 >= 1e9 rounded the initial guess of z to 1 and returned infinity.
+static void TestUpperQuantileK2() {
+	for (const auto k1 : DEGREES) {
+		const FDistribution distribution(k1, 2.0);
+
+		for (const auto alpha : ALPHAS) {
+			Check::Near(distribution.GetUpperQuantile(alpha) / GetReferenceK2(alpha, k1), 1.0L, TOLERANCE,
+				Describe("F(k, 2) at alpha", alpha, k1));
+		}
+	}
+}
+
+static void TestSurvival2K() {
+	for (const auto k2 : DEGREES) {
+		const FDistribution distribution(2.0, k2);
+
+		for (const auto x : { 0.1, 1.0, 3.0, 10.0 }) {
+			const auto expected = std::exp(-static_cast<long double>(k2) / 2.0L * std::log1p(2.0L * x / k2));
+
+			Check::Near(distribution.GetSurvival(x) / expected, 1.0L, TOLERANCE, Describe("survival of F(2, k) at x", x, k2));
+		}
+	}
+}
+
+// 1 - I_z(2, b) = (1 - z)^b (1 + b z), the complement fraction has non-zero odd terms only for a != 1.
+static void TestSurvival4K() {
+	for (const auto k2 : DEGREES) {
+		const FDistribution distribution(4.0, k2);
+
+		for (const auto x : { 0.1, 1.0, 3.0, 10.0 }) {
+			const auto b = static_cast<long double>(k2) / 2.0L;
+			const auto z = 4.0L * x / (4.0L * x + k2);
+			const auto expected = std::exp(-b * std::log1p(4.0L * x / k2)) * (1.0L + b * z);
+
+			Check::Near(distribution.GetSurvival(x) / expected, 1.0L, TOLERANCE, Describe("survival of F(4, k) at x", x, k2));
+		}
+	}
+}
+
+// n - k - 1 of 2^32 points used to wrap to a negative int.
+static void TestFisherFPastIntMax() {
+	constexpr std::int64_t K2 = (std::int64_t{ 1 } << 32) - 2;
+
+	Check::Near(FisherF(1, K2).GetFStatistics(0.05), 3.841458820694124L, 1e-8L, "table value of F(1, 2^32)");
+	Check::Near(FisherF(2, K2).GetFStatistics(0.02) / GetReference2K(0.02L, K2), 1.0L, TOLERANCE, "computed value of F(2, 2^32)");
+}
+
+int main() {
+	TestUpperQuantile11();
+	TestUpperQuantile2K();
+	TestUpperQuantileK2();
+	TestSurvival2K();
+	TestSurvival4K();
+	TestFisherFPastIntMax();
+
+	return Check::GetResult();
+}
@@ -0,0 +1,95 @@
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "Check.hpp"
+#include "DataGetter/JsonDataGetter.hpp"
+
+//-------------------- HELPERS --------------------------------------------//
+
+static std::string WriteFile(const std::string& name, const std::string& text) {
+	const auto path = (std::filesystem::temp_directory_path() / name).string();
+
+	std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+	file << text;
+
+	return path;
+}
+
+// The message of the error the getter throws, empty if the file is accepted.
+static std::string GetError(const std::string& path) {
+	try {
+		const JsonDataGetter dataGetter(std::fstream(path, std::fstream::in));
+	}
+	catch (const std::runtime_error& error) {
+		return error.what();
+	}
+
+	return {};
+}
+
+//-------------------- TESTS ----------------------------------------------//
+
+// Keys other than "data" and "confidence_probability" are skipped with everything under them,
+// including arrays of numbers and a nested "data" key.
+static void TestExtraKeysAreSkipped() {
+	const auto path = WriteFile("JsonDataGetterTests_extra_keys.json",
+		R"({"meta": {"data": [[9, 9]], "tags": ["a", true, null]}, "data": [[1, 2.5], [3, -4e1]],)"
+		R"( "note": "text", "confidence_probability": 0.9, "extra": {"rows": [[1, 2, 3]], "p": 0.5}})");
+
+	{
+		const JsonDataGetter dataGetter(std::fstream(path, std::fstream::in));
+		const auto view = dataGetter.GetView();
+
+		Check::That(view.GetSize() == 2u, "wrong point count with extra keys");
+		Check::That(view.GetX()[0] == 1.0 && view.GetX()[1] == 3.0, "wrong x with extra keys");
+		Check::That(view.GetY()[0] == 2.5 && view.GetY()[1] == -40.0, "wrong y with extra keys");
+		Check::That(dataGetter.GetConfidenceProbability() == 0.9, "wrong probability with extra keys");
+	}
+
+	std::filesystem::remove(path);
+}
+
+static void TestShortRowIsRejected() {
+	const auto path = WriteFile("JsonDataGetterTests_short_row.json",
+		R"({"data": [[1, 2], [3]], "confidence_probability": 0.9})");
+
+	Check::That(GetError(path) == "Every data row must contain at least two numbers!", "a row of one value was accepted");
+
+	std::filesystem::remove(path);
+}
+
+static void TestRowWidthsMustMatch() {
+	const auto path = WriteFile("JsonDataGetterTests_row_widths.json",
+		R"({"data": [[1, 2], [3, 4, 5]], "confidence_probability": 0.9})");
+
+	Check::That(GetError(path) == "Every data row must contain the same number of values!", "rows of different widths were accepted");
+
+	std::filesystem::remove(path);
+}
+
+static void TestRowsOfTwoRegressors() {
+	const auto path = WriteFile("JsonDataGetterTests_two_regressors.json",
+		R"({"confidence_probability": 0.95, "data": [[1, 10, 100], [2, 20, 200], [3, 30, 300]]})");
+
+	{
+		const JsonDataGetter dataGetter(std::fstream(path, std::fstream::in));
+		const auto view = dataGetter.GetDesignView();
+
+		Check::That(view.GetRowCount() == 3u && view.GetColumnCount() == 2u, "[x1, x2, y] rows did not give a k = 2 matrix");
+		Check::That(view.GetColumn(0u)[2] == 3.0 && view.GetColumn(1u)[2] == 30.0, "wrong regressor columns");
+		Check::That(view.GetY()[0] == 100.0 && view.GetY()[2] == 300.0, "wrong response column");
+	}
+
+	std::filesystem::remove(path);
+}
+
+int main() {
+	TestExtraKeysAreSkipped();
+	TestShortRowIsRejected();
+	TestRowWidthsMustMatch();
+	TestRowsOfTwoRegressors();
+
+	return Check::GetResult();
+}
@@ -0,0 +1,561 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Check.hpp"
+#include "MathSolver/MathSolver.hpp"
+#include "MathSolver/MultipleRegressionSolver.hpp"
+#include "MathSolver/OnlineMathSolver.hpp"
+#include "MathSolver/RegressionSummary.hpp"
+#include "MathSolver/SlidingWindowSolver.hpp"
+
+//-------------------- HELPERS --------------------------------------------//
+
+// y = 3x + 2 plus a deterministic saw-tooth noise, x starting at xOrigin with step xStep.
+static PointSet<double> CreatePoints(std::size_t size, double xOrigin = 0.0, double xStep = 1.0) {
+	PointSet<double> points(size);
+
+	const auto x = points.GetX();
+	const auto y = points.GetY();
+
+	for (std::size_t i = 0u; i < size; ++i) {
+		x[i] = xOrigin + xStep * static_cast<double>(i);
+		y[i] = 3.0 * x[i] + 2.0 + static_cast<double>(i % 7u) - 3.0;
+	}
+
+	return points;
+}
+
+// y = 1.5 + 2 x1 - 0.5 x2 + 0.25 x3 + noise, x3 = x1 + 2 x2 exactly if collinear.
+static DesignMatrix<double> CreateDesign(std::size_t size, bool collinear = false) {
+	DesignMatrix<double> design(3u);
+	design.Reserve(size);
+
+	for (std::size_t i = 0u; i < size; ++i) {
+		const auto x1 = 0.01 * static_cast<double>(i);
+		const auto x2 = static_cast<double>(i * i % 13u);
+		const auto x3 = collinear ? x1 + 2.0 * x2 : 0.5 * static_cast<double>(i * 7u % 11u);
+
+		const double row[] = { x1, x2, x3 };
+		design.Add(row, 1.5 + 2.0 * x1 - 0.5 * x2 + 0.25 * x3 + (static_cast<double>(i % 5u) - 2.0) * 1e-3);
+	}
+
+	return design;
+}
+
+// The message of the error the solver throws, empty if the fit succeeds.
+static std::string GetSolverError(DesignMatrixView<double> data) {
+	try {
+		const MultipleRegressionSolver<double> solver(data);
+	}
+	catch (const std::runtime_error& error) {
+		return error.what();
+	}
+
+	return {};
+}
+
+// The online fit must be the batch fit of the points it currently holds. Its SSE is Syy - SSR,
+// which loses the digits of Syy / SSE, so F is compared to that many fewer digits.
+static void CheckOnlineMatches(const OnlineMathSolver<double>& online, PointSetView<double> points, const std::string& what) {
+	const MathSolver<double> reference(points);
+
+	const auto sumSquaredError = static_cast<long double>(reference.GetSumCapYYDiffProduct());
+	const auto conditioning = (reference.GetSumCapYTildeYDiffProduct() + sumSquaredError) / sumSquaredError;
+
+	Check::That(online.GetSize() == reference.GetSize(), "point count, " + what);
+	Check::Near(online.GetXExpectedValue(), reference.GetXExpectedValue(), 1e-12L, "mean of x, " + what);
+	Check::Near(online.GetYExpectedValue(), reference.GetYExpectedValue(), 1e-12L, "mean of y, " + what);
+	Check::Near(online.GetAlphaOne(), reference.GetAlphaOne(), 1e-12L, "slope, " + what);
+	Check::Near(online.GetAlphaZero(), reference.GetAlphaZero(), 1e-12L, "intercept, " + what);
+	Check::Near(online.GetFStatistics() / reference.GetFStatistics(), 1.0L, 1e-12L * conditioning, "F-statistic, " + what);
+}
+
+static std::string GetWindowError(PointSetView<double> points, std::size_t window, std::size_t stride) {
+	try {
+		const SlidingWindowSolver<double> solver(points, window, stride);
+	}
+	catch (const std::runtime_error& error) {
+		return error.what();
+	}
+
+	return {};
+}
+
+// Every window must be the fit of a fresh MathSolver on its points. The intercept y - a1 x of a narrow window
+// far from x = 0 cancels, so it is compared relative to the mean of y, and F to the digits its SSE keeps.
+static void CheckWindowsMatch(const SlidingWindowSolver<double>& solver, PointSetView<double> points, const std::string& what) {
+	const auto window = solver.GetWindowSize();
+	const auto stride = solver.GetStride();
+	const auto& windows = solver.GetWindows();
+
+	Check::That(windows.size() == (points.GetSize() - window) / stride + 1u, "window count, " + what);
+
+	for (std::size_t i = 0u; i < windows.size(); ++i) {
+		Check::That(windows[i].offset == i * stride, "window offset, " + what);
+
+		const MathSolver<double> reference(points.GetSubView(windows[i].offset, window));
+
+		const auto sumSquaredError = static_cast<long double>(reference.GetSumCapYYDiffProduct());
+		const auto conditioning = (reference.GetSumCapYTildeYDiffProduct() + sumSquaredError) / sumSquaredError;
+
+		Check::Near(windows[i].alphaOne, reference.GetAlphaOne(), 1e-11L, "window slope, " + what);
+		Check::Near(windows[i].alphaZero / reference.GetYExpectedValue(), reference.GetAlphaZero() / reference.GetYExpectedValue(), 1e-11L,
+			"window intercept, " + what);
+		Check::Near(windows[i].fStatistics / reference.GetFStatistics(), 1.0L, 1e-11L * conditioning, "window F-statistic, " + what);
+	}
+}
+
+static std::string GetTempPath(const std::string& name) {
+	return (std::filesystem::temp_directory_path() / name).string();
+}
+
+static std::string GetSummaryError(const std::string& path) {
+	try {
+		const auto summary = RegressionSummary::Read(path);
+	}
+	catch (const std::runtime_error& error) {
+		return error.what();
+	}
+
+	return {};
+}
+
+// Everything Main does with a solver: the fit, every table column and the F-statistic.
+static double RunPipeline(const PointSet<double>& points) {
+	const auto solver = MathSolver<double>{ points.GetView() };
+
+	auto checksum = solver.GetFStatistics();
+
+	for (const auto& column : {
+		solver.GetDataXXProduct(), solver.GetDataXYProduct(), solver.GetDataYYProduct(),
+		solver.GetDataYCap(), solver.GetDataYCapYTildeDiff(), solver.GetDataYCapYTildeDiffProduct(),
+		solver.GetDataYCapYDiff(), solver.GetDataYCapYDiffProduct() }) {
+		checksum += column.back();
+	}
+
+	return checksum;
+}
+
+struct ReferenceFit {
+	long double alphaOne, alphaZero, yMean;
+};
+
+// Two-pass least squares in long double: means first, then the centered sums.
+static ReferenceFit GetReferenceFit(PointSetView<double> points) {
+	const auto x = points.GetX();
+	const auto y = points.GetY();
+	const auto n = static_cast<long double>(x.size());
+
+	auto sumX = 0.0L, sumY = 0.0L;
+
+	for (std::size_t i = 0u; i < x.size(); ++i) {
+		sumX += x[i];
+		sumY += y[i];
+	}
+
+	const auto xMean = sumX / n;
+	const auto yMean = sumY / n;
+
+	auto sumXX = 0.0L, sumXY = 0.0L;
+
+	for (std::size_t i = 0u; i < x.size(); ++i) {
+		sumXX += (x[i] - xMean) * (x[i] - xMean);
+		sumXY += (x[i] - xMean) * (y[i] - yMean);
+	}
+
+	const auto alphaOne = sumXY / sumXX;
+	return ReferenceFit{ alphaOne, yMean - alphaOne * xMean, yMean };
+}
+
+static double GetBestSeconds(const PointSet<double>& points) {
+	auto best = std::numeric_limits<double>::infinity();
+
+	for (auto i = 0; i < 5; ++i) {
+		const auto start = std::chrono::steady_clock::now();
+		const volatile auto checksum = RunPipeline(points);
+		const auto finish = std::chrono::steady_clock::now();
+
+		static_cast<void>(checksum);
+		best = std::min(best, std::chrono::duration<double>(finish - start).count());
+	}
+
+	return best;
+}
+
+//-------------------- TESTS ----------------------------------------------//
+
+// Every statistic is computed once and reused, so 4x the points must cost about 4x the time
+// (up to 10x for cache effects).
+// A per-element recomputation of a mean would make the ratio 16.
+static void TestPipelineIsLinearInSize() {
+	constexpr std::size_t SIZE = 1u << 18u;
+
+	const auto small = GetBestSeconds(CreatePoints(SIZE));
+	const auto large = GetBestSeconds(CreatePoints(4u * SIZE));
+
+	std::cout << "pipeline: " << small * 1e3 << " ms at n, " << large * 1e3 << " ms at 4n\n";
+
+	Check::That(large < 10.0 * small, "pipeline time grows faster than linearly");
+}
+
+// With a1 = x = 1 + 2^-30 and a0 = -(1 + 2^-29) the product a1 * x rounds to -a0, so y^ = 0 exactly,
+// while a fused multiply-add keeps the 2^-60 tail. Every sum below is exact in any order,
+// so each kernel must return zeros bit for bit.
+static void TestResidualKernelsRoundLikeScalar() {
+	const auto alphaOne = 1.0 + std::ldexp(1.0, -30);
+	const auto alphaZero = -(1.0 + std::ldexp(1.0, -29));
+
+	const std::vector<double> x(67u, alphaOne);
+	const std::vector<double> y(x.size(), 0.0);
+
+	const auto best = MomentKernels::GetInstructionSet();
+
+	for (const auto instructionSet : { InstructionSet::Scalar, InstructionSet::Sse2, InstructionSet::Avx2, InstructionSet::Avx512 }) {
+		if (instructionSet > best) {
+			break;
+		}
+
+		for (const auto summation : { Summation::Naive, Summation::Kahan }) {
+			const auto residuals = MomentKernels::AccumulateResiduals<double>(x, y, alphaOne, alphaZero, 0.0, summation, instructionSet);
+
+			Check::That(residuals.GetSumCapY() == 0.0, "y^ was computed with a fused multiply-add");
+			Check::That(residuals.GetSumCapYYDiff() == 0.0, "y^ - y was computed with a fused multiply-add");
+		}
+	}
+}
+
+// Timestamp-like x = 1.7e9 + i / 1024 with y = 3x + 2 + noise over several chunks: n Sxx - Sx^2 cancels
+// the digits in double, the centered moments must still match the long double fit for either
+// summation and with the chunks merged from a thread pool. The intercept y - a1 x is a difference of
+// two 5e9 terms, so it is compared relative to the mean of y.
+static void TestIllConditionedFitMatchesLongDouble() {
+	constexpr std::size_t SIZE = 3u * (1u << 16u) + 123u;
+
+	const auto points = CreatePoints(SIZE, 1.7e9, 1.0 / 1024.0);
+	const auto reference = GetReferenceFit(points.GetView());
+
+	// The inputs are ill-conditioned only if the textbook formula in double is visibly wrong.
+	const auto x = points.GetView().GetX();
+	const auto y = points.GetView().GetY();
+	const auto n = static_cast<double>(SIZE);
+
+	auto sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+
+	for (std::size_t i = 0u; i < SIZE; ++i) {
+		sumX += x[i];
+		sumY += y[i];
+		sumXX += x[i] * x[i];
+		sumXY += x[i] * y[i];
+	}
+
+	const auto textbook = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+	Check::That(!(std::fabs(textbook / reference.alphaOne - 1.0L) < 1e-3L), "the textbook slope is accurate, the inputs are too easy");
+
+	for (const auto summation : { Summation::Naive, Summation::Kahan }) {
+		for (const auto threadCount : { 0u, 4u }) {
+			SolverOptions options;
+			options.summation = summation;
+			options.threadPool = threadCount == 0u ? nullptr : std::make_shared<ThreadPool>(threadCount);
+
+			const MathSolver<double> solver(points.GetView(), options);
+
+			const auto what = std::string(summation == Summation::Naive ? "naive" : "Kahan")
+				+ (threadCount == 0u ? ", serial" : ", thread pool");
+
+			Check::Near(solver.GetAlphaOne() / reference.alphaOne, 1.0L, 1e-12L, "slope, " + what);
+			Check::Near(solver.GetAlphaZero() / reference.yMean, reference.alphaZero / reference.yMean, 1e-12L, "intercept, " + what);
+		}
+	}
+}
+
+// The chunk boundaries and the merge order do not depend on the pool, so the sums must be equal bit for bit.
+static void TestThreadPoolIsBitExact() {
+	constexpr std::size_t SIZE = 5u * (1u << 16u) + 321u;
+
+	const auto points = CreatePoints(SIZE, 12.5, 0.37);
+
+	for (const auto summation : { Summation::Naive, Summation::Kahan }) {
+		SolverOptions options;
+		options.summation = summation;
+
+		const MathSolver<double> serial(points.GetView(), options);
+
+		options.threadPool = std::make_shared<ThreadPool>(4u);
+		const MathSolver<double> parallel(points.GetView(), options);
+
+		Check::That(parallel.GetSumXYProduct() == serial.GetSumXYProduct(), "sum of xy depends on the thread pool");
+		Check::That(parallel.GetAlphaOne() == serial.GetAlphaOne(), "slope depends on the thread pool");
+		Check::That(parallel.GetAlphaZero() == serial.GetAlphaZero(), "intercept depends on the thread pool");
+		Check::That(parallel.GetSumCapYYDiffProduct() == serial.GetSumCapYYDiffProduct(), "residual sum depends on the thread pool");
+		Check::That(parallel.GetFStatistics() == serial.GetFStatistics(), "F-statistic depends on the thread pool");
+	}
+}
+
+static void TestMultipleRegressionRecoversCoefficients() {
+	const auto design = CreateDesign(2000u);
+	const MultipleRegressionSolver<double> solver(design.GetView());
+
+	const auto coefficients = solver.GetCoefficients();
+
+	Check::That(solver.GetK() == 3 && coefficients.size() == 3u, "wrong number of coefficients");
+	Check::Near(coefficients[0], 2.0L, 1e-5L, "a1 of the k = 3 fit");
+	Check::Near(coefficients[1], -0.5L, 1e-5L, "a2 of the k = 3 fit");
+	Check::Near(coefficients[2], 0.25L, 1e-5L, "a3 of the k = 3 fit");
+	Check::Near(solver.GetIntercept(), 1.5L, 1e-4L, "a0 of the k = 3 fit");
+	Check::That(solver.GetDeterminationCoefficient() > 0.999999, "the k = 3 fit does not explain the data");
+}
+
+static void TestMultipleRegressionMatchesSimple() {
+	const auto points = CreatePoints(1000u, -3.0, 0.25);
+
+	const MathSolver<double> simple(points.GetView());
+	const MultipleRegressionSolver<double> multiple(DesignMatrixView<double>{ points.GetView() });
+
+	Check::That(multiple.GetK() == 1, "a point set is not a k = 1 design");
+	Check::Near(multiple.GetCoefficients()[0], simple.GetAlphaOne(), 1e-12L, "a1 of the k = 1 fit");
+	Check::Near(multiple.GetIntercept(), simple.GetAlphaZero(), 1e-12L, "a0 of the k = 1 fit");
+	Check::Near(multiple.GetFStatistics() / simple.GetFStatistics(), 1.0L, 1e-10L, "F of the k = 1 fit");
+}
+
+static void TestMultipleRegressionRejectsBadDesigns() {
+	Check::That(GetSolverError(CreateDesign(500u, true).GetView()) == "Regressors are linearly dependent!",
+		"collinear regressors were accepted");
+
+	for (const auto size : { 0u, 1u, 4u }) {
+		Check::That(GetSolverError(CreateDesign(size).GetView()) == "Not enough observations for the number of regressors!",
+			"n <= k + 1 was accepted");
+	}
+
+	Check::That(GetSolverError(CreateDesign(5u).GetView()).empty(), "n = k + 2 was rejected");
+}
+
+// Chunks of 2^14 rows, so three and a part of them here.
+static void TestMultipleRegressionThreadPoolIsBitExact() {
+	const auto design = CreateDesign(3u * (1u << 14u) + 77u);
+
+	SolverOptions options;
+	const MultipleRegressionSolver<double> serial(design.GetView(), options);
+
+	options.threadPool = std::make_shared<ThreadPool>(4u);
+	const MultipleRegressionSolver<double> parallel(design.GetView(), options);
+
+	for (std::size_t j = 0u; j < 3u; ++j) {
+		Check::That(parallel.GetCoefficients()[j] == serial.GetCoefficients()[j], "coefficient depends on the thread pool");
+	}
+
+	Check::That(parallel.GetIntercept() == serial.GetIntercept(), "intercept depends on the thread pool");
+	Check::That(parallel.GetFStatistics() == serial.GetFStatistics(), "F-statistic of the k = 3 fit depends on the thread pool");
+}
+
+static void TestOnlineSolverMatchesBatch() {
+	constexpr std::size_t SIZE = 1000u;
+	constexpr std::size_t TAIL = 100u;
+
+	const auto points = CreatePoints(SIZE, -20.0, 0.5);
+	const auto view = points.GetView();
+	const auto x = view.GetX();
+	const auto y = view.GetY();
+
+	OnlineMathSolver<double> added;
+
+	for (std::size_t i = 0u; i < SIZE; ++i) {
+		added.Add(x[i], y[i]);
+	}
+
+	CheckOnlineMatches(added, view, "point by point");
+
+	OnlineMathSolver<double> batches;
+	batches.AddBatch(view.GetSubView(0u, 400u));
+	batches.AddBatch(view.GetSubView(400u, SIZE - 400u));
+
+	CheckOnlineMatches(batches, view, "two batches");
+
+	const auto extra = CreatePoints(TAIL, 1000.0, 3.0);
+	OnlineMathSolver<double> restored(view);
+
+	for (std::size_t i = 0u; i < TAIL; ++i) {
+		restored.Add(extra.GetView().GetX()[i], extra.GetView().GetY()[i]);
+	}
+
+	for (std::size_t i = 0u; i < TAIL; ++i) {
+		restored.Remove(extra.GetView().GetX()[i], extra.GetView().GetY()[i]);
+	}
+
+	CheckOnlineMatches(restored, view, "adds undone by removes");
+
+	OnlineMathSolver<double> shrunk(view);
+
+	for (std::size_t i = SIZE; i-- > SIZE - TAIL;) {
+		shrunk.Remove(x[i], y[i]);
+	}
+
+	CheckOnlineMatches(shrunk, view.GetSubView(0u, SIZE - TAIL), "tail removed");
+}
+
+// Overlapping windows slide, disjoint ones (S >= W) are computed directly. With W = 20 and S = 1 the moments
+// are rebuilt after every 8 W = 160 updates, 80 windows, so 481 windows cross that point several times.
+static void TestSlidingWindowsMatchFreshFits() {
+	const auto points = CreatePoints(500u, -20.0, 0.5);
+	const auto view = points.GetView();
+
+	CheckWindowsMatch(SlidingWindowSolver<double>(view, 50u, 7u), view, "W = 50, S = 7");
+	CheckWindowsMatch(SlidingWindowSolver<double>(view, 40u, 40u), view, "W = 40, S = 40");
+	CheckWindowsMatch(SlidingWindowSolver<double>(view, 30u, 45u), view, "W = 30, S = 45");
+	CheckWindowsMatch(SlidingWindowSolver<double>(view, 20u, 1u), view, "W = 20, S = 1");
+	CheckWindowsMatch(SlidingWindowSolver<double>(view, 500u, 1u), view, "W = n");
+
+	Check::That(SlidingWindowSolver<double>(view, 501u, 1u).GetWindows().empty(), "a window longer than the data was fitted");
+}
+
+// Ranges of 4096 windows run as separate tasks, each from fresh moments, so the pool changes nothing.
+static void TestSlidingWindowsThreadPoolIsBitExact() {
+	const auto points = CreatePoints(3u * 4096u + 500u, 7.0, 0.25);
+	const auto view = points.GetView();
+
+	SolverOptions options;
+	const SlidingWindowSolver<double> serial(view, 10u, 1u, options);
+
+	options.threadPool = std::make_shared<ThreadPool>(4u);
+	const SlidingWindowSolver<double> parallel(view, 10u, 1u, options);
+
+	CheckWindowsMatch(parallel, view, "W = 10, S = 1, thread pool");
+
+	const auto isEqual = std::equal(serial.GetWindows().begin(), serial.GetWindows().end(),
+		parallel.GetWindows().begin(), parallel.GetWindows().end(), [](const auto& left, const auto& right) {
+			return left.offset == right.offset && left.alphaOne == right.alphaOne && left.alphaZero == right.alphaZero
+				&& left.fStatistics == right.fStatistics;
+		});
+
+	Check::That(isEqual, "windows depend on the thread pool");
+}
+
+static void TestSlidingWindowsRejectBadArguments() {
+	const auto points = CreatePoints(100u);
+
+	Check::That(GetWindowError(points.GetView(), 2u, 1u) == "Window must contain at least three points!", "W = 2 was accepted");
+	Check::That(GetWindowError(points.GetView(), 0u, 1u) == "Window must contain at least three points!", "W = 0 was accepted");
+	Check::That(GetWindowError(points.GetView(), 10u, 0u) == "Stride must be positive!", "S = 0 was accepted");
+	Check::That(GetWindowError(points.GetView(), 3u, 1u).empty(), "W = 3 was rejected");
+}
+
+static void TestSummaryRoundTrip() {
+	const auto path = GetTempPath(std::string{ "MathSolverTests_round_trip" } + RegressionSummary::EXTENSION_STR);
+
+	const auto points = CreatePoints(1000u, -20.0, 0.5);
+	const auto written = RegressionSummary::FromView(points.GetView(), 0.95);
+	written.Write(path);
+
+	const auto read = RegressionSummary::Read(path);
+	const auto& expected = written.GetMoments();
+	const auto& actual = read.GetMoments();
+
+	Check::That(actual.GetCount() == expected.GetCount(), "wrong count after the round trip");
+	Check::That(actual.GetXExpectedValue() == expected.GetXExpectedValue() && actual.GetYExpectedValue() == expected.GetYExpectedValue(),
+		"wrong means after the round trip");
+	Check::That(actual.GetSumXX() == expected.GetSumXX() && actual.GetSumYY() == expected.GetSumYY() && actual.GetSumXY() == expected.GetSumXY(),
+		"wrong co-moments after the round trip");
+	Check::That(read.GetConfidenceProbability() == 0.95, "wrong probability after the round trip");
+
+	std::filesystem::remove(path);
+}
+
+static void TestSummaryMergeMatchesWholeSet() {
+	const auto points = CreatePoints(1000u, 1e6, 0.125);
+	const auto view = points.GetView();
+
+	RegressionSummary merged;
+	merged.Merge(RegressionSummary::FromView(view.GetSubView(0u, 137u), 0.9));
+	merged.Merge(RegressionSummary::FromView(view.GetSubView(137u, 600u), 0.9));
+	merged.Merge(RegressionSummary::FromView(view.GetSubView(737u, 263u), 0.9));
+
+	const auto whole = RegressionSummary::FromView(view, 0.9);
+	const auto& expected = whole.GetMoments();
+	const auto& actual = merged.GetMoments();
+
+	Check::That(actual.GetCount() == expected.GetCount(), "wrong count of the merged summary");
+	Check::Near(actual.GetXExpectedValue(), expected.GetXExpectedValue(), 1e-13L, "mean of x of the merged summary");
+	Check::Near(actual.GetYExpectedValue(), expected.GetYExpectedValue(), 1e-13L, "mean of y of the merged summary");
+	Check::Near(actual.GetSumXX(), expected.GetSumXX(), 1e-12L, "sum of xx of the merged summary");
+	Check::Near(actual.GetSumYY(), expected.GetSumYY(), 1e-12L, "sum of yy of the merged summary");
+	Check::Near(actual.GetSumXY(), expected.GetSumXY(), 1e-12L, "sum of xy of the merged summary");
+	Check::That(merged.GetConfidenceProbability() == 0.9, "wrong probability of the merged summary");
+}
+
+static void TestSummaryRejectsBadInput() {
+	const auto points = CreatePoints(10u);
+
+	auto summary = RegressionSummary::FromView(points.GetView(), 0.95);
+	auto isRejected = false;
+
+	try {
+		summary.Merge(RegressionSummary::FromView(points.GetView(), 0.9));
+	}
+	catch (const std::runtime_error& error) {
+		isRejected = std::string{ error.what() } == "Summaries have different confidence probabilities!";
+	}
+
+	Check::That(isRejected, "summaries of different probabilities were merged");
+
+	const auto path = GetTempPath(std::string{ "MathSolverTests_bad" } + RegressionSummary::EXTENSION_STR);
+	summary.Write(path);
+
+	RegressionSummaryHeader header{};
+
+	{
+		std::ifstream file(path, std::ifstream::binary);
+		file.read(reinterpret_cast<char*>(&header), sizeof(header));
+	}
+
+	const auto writeFile = [&path](const RegressionSummaryHeader& header, std::size_t size) {
+		std::ofstream file(path, std::ofstream::binary | std::ofstream::trunc);
+		file.write(reinterpret_cast<const char*>(&header), static_cast<std::streamsize>(size));
+	};
+
+	writeFile(header, sizeof(header) - 1u);
+	Check::That(GetSummaryError(path) == "Wrong summary file format!", "a truncated summary was accepted");
+
+	auto badMagic = header;
+	badMagic.magic[0] = 'X';
+	writeFile(badMagic, sizeof(header));
+	Check::That(GetSummaryError(path) == "Wrong summary file format!", "a summary with a wrong magic was accepted");
+
+	auto badVersion = header;
+	badVersion.version = RegressionSummaryHeader::VERSION + 1u;
+	writeFile(badVersion, sizeof(header));
+	Check::That(GetSummaryError(path) == "Wrong summary file format!", "a summary of another version was accepted");
+
+	writeFile(header, sizeof(header));
+	Check::That(GetSummaryError(path).empty(), "an intact summary was rejected");
+
+	std::filesystem::remove(path);
+}
+
+int main() {
+	TestPipelineIsLinearInSize();
+	TestResidualKernelsRoundLikeScalar();
+	TestIllConditionedFitMatchesLongDouble();
+	TestThreadPoolIsBitExact();
+	TestMultipleRegressionRecoversCoefficients();
+	TestMultipleRegressionMatchesSimple();
+	TestMultipleRegressionRejectsBadDesigns();
+	TestMultipleRegressionThreadPoolIsBitExact();
+	TestOnlineSolverMatchesBatch();
+	TestSlidingWindowsMatchFreshFits();
+	TestSlidingWindowsThreadPoolIsBitExact();
+	TestSlidingWindowsRejectBadArguments();
+	TestSummaryRoundTrip();
+	TestSummaryMergeMatchesWholeSet();
+	TestSummaryRejectsBadInput();
+
+	return Check::GetResult();
+}
@@ -0,0 +1,320 @@
+#include <algorithm>
+#include <charconv>
+#include <functional>
+#include <locale>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "Check.hpp"
+#include "MathSolver/MathSolver.hpp"
+#include "Table/NumericTable.hpp"
+#include "Table/RowSelection.hpp"
+
+// The table tabulate printed for x64/Debug/test.json before NumericTable replaced it.
+static constexpr auto* TEST_JSON_TABLE =
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| N    | X_i     | Y_i     | X_i * Y_i | X_i^^2 | Y_i^^2  | ^y_i    | ^y_i - ~y | (^y_i - ~y)^^2 | ^y_i - y_i | (^y_i - y_i)^^2 |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| 1    | 1.0000  | 0.0000  | 0.0000    | 1.0000 | 0.0000  | 0.3103  | 0.9770    | 0.9546         | 0.3103     | 0.0963          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| 2    | -1.0000 | -2.0000 | 2.0000    | 1.0000 | 4.0000  | -2.0345 | -1.3678   | 1.8709         | -0.0345    | 0.0012          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| 3    | 1.0000  | 1.0000  | 1.0000    | 1.0000 | 1.0000  | 0.3103  | 0.9770    | 0.9546         | -0.6897    | 0.4756          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| 4    | 1.0000  | 0.0000  | 0.0000    | 1.0000 | 0.0000  | 0.3103  | 0.9770    | 0.9546         | 0.3103     | 0.0963          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| 5    | -1.0000 | -2.0000 | 2.0000    | 1.0000 | 4.0000  | -2.0345 | -1.3678   | 1.8709         | -0.0345    | 0.0012          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| 6    | 0.0000  | -1.0000 | -0.0000   | 0.0000 | 1.0000  | -0.8621 | -0.1954   | 0.0382         | 0.1379     | 0.0190          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+\n"
+	"| sum: | 1.0000  | -4.0000 | 5.0000    | 5.0000 | 10.0000 | -4.0000 | 0.0000    | 6.6437         | -0.0000    | 0.6897          |\n"
+	"+------+---------+---------+-----------+--------+---------+---------+-----------+----------------+------------+-----------------+";
+
+//-------------------- HELPERS --------------------------------------------//
+
+static PointSet<double> CreateTestJsonPoints() {
+	return PointSet<double>{
+		Point<double>{ 1.0, 0.0 }, Point<double>{ -1.0, -2.0 }, Point<double>{ 1.0, 1.0 },
+		Point<double>{ 1.0, 0.0 }, Point<double>{ -1.0, -2.0 }, Point<double>{ 0.0, -1.0 }
+	};
+}
+
+// The "{:.4f}" Main formats the sums with, GCC 12 has no <format>.
+static std::string Format(double value) {
+	char number[64];
+	const auto result = std::to_chars(number, number + sizeof(number), value, std::chars_format::fixed, 4);
+
+	return std::string(number, result.ptr);
+}
+
+// The columns and the sum row Main::CreateTable builds, with consecutive row numbers or explicit rows.
+static NumericTable<double> CreateTable(const MathSolver<double>& solver, bool isConsecutive) {
+	NumericTable<double> table({
+			"N", "X_i", "Y_i",
+			"X_i * Y_i", "X_i^^2",
+			"Y_i^^2", "^y_i", "^y_i - ~y",
+			"(^y_i - ~y)^^2", "^y_i - y_i",
+			"(^y_i - y_i)^^2"
+		}
+	);
+
+	if (isConsecutive) {
+		table.AddIndexColumn();
+	}
+	else {
+		std::vector<std::size_t> rows(solver.GetSize());
+		std::iota(rows.begin(), rows.end(), std::size_t{ 0u });
+
+		table.AddIndexColumn(std::move(rows));
+	}
+
+	const auto x = solver.GetDataX();
+	const auto y = solver.GetDataY();
+
+	table.AddColumn(std::vector<double>(x.begin(), x.end()));
+	table.AddColumn(std::vector<double>(y.begin(), y.end()));
+	table.AddColumn(solver.GetDataXYProduct());
+	table.AddColumn(solver.GetDataXXProduct());
+	table.AddColumn(solver.GetDataYYProduct());
+	table.AddColumn(solver.GetDataYCap());
+	table.AddColumn(solver.GetDataYCapYTildeDiff());
+	table.AddColumn(solver.GetDataYCapYTildeDiffProduct());
+	table.AddColumn(solver.GetDataYCapYDiff());
+	table.AddColumn(solver.GetDataYCapYDiffProduct());
+
+	table.AddFooter({
+			std::string{ "sum:" },
+			Format(solver.GetSumX()),
+			Format(solver.GetSumY()),
+			Format(solver.GetSumXYProduct()),
+			Format(solver.GetSumXXProduct()),
+			Format(solver.GetSumYYProduct()),
+			Format(solver.GetSumCapY()),
+			Format(solver.GetSumCapYTildeYDiff()),
+			Format(solver.GetSumCapYTildeYDiffProduct()),
+			Format(solver.GetSumCapYYDiff()),
+			Format(solver.GetSumCapYYDiffProduct())
+		}
+	);
+
+	return table;
+}
+
+template<class T>
+static std::string Print(const NumericTable<T>& table) {
+	std::ostringstream out;
+	out << table;
+
+	return std::move(out).str();
+}
+
+template<class T>
+static bool IsRejected(const NumericTable<T>& table) {
+	try {
+		static_cast<void>(Print(table));
+	}
+	catch (const std::runtime_error& error) {
+		return std::string{ error.what() } == "Table rows have different sizes!";
+	}
+
+	return false;
+}
+
+// Decimal comma and thousands grouping, as many system locales have.
+class CommaNumpunct final : public std::numpunct<char> {
+protected:
+	[[nodiscard]] char do_decimal_point() const override {
+		return ',';
+	}
+
+	[[nodiscard]] char do_thousands_sep() const override {
+		return '.';
+	}
+
+	[[nodiscard]] std::string do_grouping() const override {
+		return "\3";
+	}
+};
+
+static std::string GetParseError(std::string_view text) {
+	try {
+		static_cast<void>(RowSelection::Parse(text));
+	}
+	catch (const std::runtime_error& error) {
+		return error.what();
+	}
+
+	return {};
+}
+
+//-------------------- TESTS ----------------------------------------------//
+
+// Widths, -0.0000 cells and the sum row must come out as tabulate printed them.
+static void TestTableMatchesTabulate() {
+	const auto points = CreateTestJsonPoints();
+	const MathSolver<double> solver(points.GetView());
+
+	Check::That(Print(CreateTable(solver, true)) == TEST_JSON_TABLE, "the table differs from the tabulate output");
+	Check::That(Print(CreateTable(solver, false)) == TEST_JSON_TABLE, "the table of explicit rows differs from the tabulate output");
+}
+
+// Main prints tables from worker threads, so neither the global locale nor the stream's may change a cell.
+static void TestTableIgnoresLocaleAndThreads() {
+	const auto points = CreateTestJsonPoints();
+	const MathSolver<double> solver(points.GetView());
+	const auto table = CreateTable(solver, true);
+
+	const auto previous = std::locale::global(std::locale(std::locale::classic(), new CommaNumpunct));
+
+	{
+		std::ostringstream out;
+		out.imbue(std::locale());
+		out << table;
+
+		Check::That(out.str() == TEST_JSON_TABLE, "the table depends on the locale");
+	}
+
+	std::vector<std::string> outputs(4u);
+	std::vector<std::thread> threads;
+
+	for (auto& output : outputs) {
+		threads.emplace_back([&table, &output] {
+			for (auto i = 0; i < 100; ++i) {
+				output = Print(table);
+			}
+		});
+	}
+
+	for (auto& thread : threads) {
+		thread.join();
+	}
+
+	std::locale::global(previous);
+
+	for (const auto& output : outputs) {
+		Check::That(output == TEST_JSON_TABLE, "a table printed from a thread differs");
+	}
+}
+
+// A column is as wide as its widest cell: the header, a footer, the last row number,
+// the most negative value or a value that rounds up to one more digit.
+static void TestColumnWidths() {
+	NumericTable<double> table({ "N", "value", "v" });
+	table.AddIndexColumn({ 0u, 9u });
+	table.AddColumn({ -1234.5, 2.0 });
+	table.AddColumn({ 1.0, 99999.99999 });
+	table.AddFooter({ "sum:", "-1232.5000", "x" });
+
+	Check::That(Print(table) ==
+		"+------+------------+-------------+\n"
+		"| N    | value      | v           |\n"
+		"+------+------------+-------------+\n"
+		"| 1    | -1234.5000 | 1.0000      |\n"
+		"+------+------------+-------------+\n"
+		"| 10   | 2.0000     | 100000.0000 |\n"
+		"+------+------------+-------------+\n"
+		"| sum: | -1232.5000 | x           |\n"
+		"+------+------------+-------------+",
+		"wrong column widths");
+}
+
+static void TestMismatchedColumnsAreRejected() {
+	NumericTable<double> shortColumn({ "N", "a", "b" });
+	shortColumn.AddIndexColumn();
+	shortColumn.AddColumn({ 1.0, 2.0 });
+	shortColumn.AddColumn({ 1.0 });
+
+	Check::That(IsRejected(shortColumn), "columns of different lengths were printed");
+
+	NumericTable<double> shortRows({ "N", "a" });
+	shortRows.AddIndexColumn({ 0u });
+	shortRows.AddColumn({ 1.0, 2.0 });
+
+	Check::That(IsRejected(shortRows), "an index column of fewer rows was printed");
+
+	NumericTable<double> missingColumn({ "N", "a", "b" });
+	missingColumn.AddIndexColumn();
+	missingColumn.AddColumn({ 1.0 });
+
+	Check::That(IsRejected(missingColumn), "a header wider than the columns was printed");
+
+	NumericTable<double> shortFooter({ "N", "a" });
+	shortFooter.AddIndexColumn();
+	shortFooter.AddColumn({ 1.0 });
+	shortFooter.AddFooter({ "sum:" });
+
+	Check::That(IsRejected(shortFooter), "a footer narrower than the columns was printed");
+}
+
+static void TestRowSelectionParse() {
+	Check::That(RowSelection::Parse("all").GetMode() == RowMode::All, "all was not parsed");
+	Check::That(RowSelection::Parse("none").GetMode() == RowMode::None, "none was not parsed");
+
+	const auto head = RowSelection::Parse("head:5");
+	const auto tail = RowSelection::Parse("tail:0");
+	const auto sample = RowSelection::Parse("sample:18446744073709551615");
+
+	Check::That(head.GetMode() == RowMode::Head && head.GetCount() == 5u, "head:5 was not parsed");
+	Check::That(tail.GetMode() == RowMode::Tail && tail.GetCount() == 0u, "tail:0 was not parsed");
+	Check::That(sample.GetMode() == RowMode::Sample && sample.GetCount() == 18446744073709551615u, "sample:2^64-1 was not parsed");
+
+	for (const auto* text : { "head:", "head:-1", "head:+1", "head:1x", "head: 1", "tail:18446744073709551616" }) {
+		Check::That(GetParseError(text) == "Wrong row count!", std::string{ "wrong count was accepted: " } + text);
+	}
+
+	for (const auto* text : { "foo", "", "All", "head", "first:3", ":3" }) {
+		Check::That(GetParseError(text) == "Unknown row mode!", std::string{ "unknown mode was accepted: " } + text);
+	}
+}
+
+static void TestRowSelectionGetRows() {
+	using Rows = std::vector<std::size_t>;
+
+	Check::That(RowSelection{ RowMode::All }.GetRows(4u) == Rows{ 0u, 1u, 2u, 3u }, "wrong rows of all");
+	Check::That(RowSelection{ RowMode::None }.GetRows(4u).empty(), "none gave rows");
+	Check::That(RowSelection{ RowMode::Head, 2u }.GetRows(5u) == Rows{ 0u, 1u }, "wrong rows of head:2");
+	Check::That(RowSelection{ RowMode::Tail, 2u }.GetRows(5u) == Rows{ 3u, 4u }, "wrong rows of tail:2");
+
+	// N > n shows every row, N = 0 and n = 0 show none.
+	for (const auto mode : { RowMode::Head, RowMode::Tail, RowMode::Sample }) {
+		Check::That(RowSelection{ mode, 10u }.GetRows(3u) == Rows{ 0u, 1u, 2u }, "N > n did not give every row");
+		Check::That(RowSelection{ mode, 0u }.GetRows(3u).empty(), "N = 0 gave rows");
+		Check::That(RowSelection{ mode, 3u }.GetRows(0u).empty(), "n = 0 gave rows");
+	}
+
+	Check::That(RowSelection{ RowMode::All }.GetRows(0u).empty(), "all of n = 0 gave rows");
+}
+
+// N distinct ascending rows starting at the first one, spread evenly over the data.
+static void TestRowSelectionSample() {
+	Check::That(RowSelection{ RowMode::Sample, 4u }.GetRows(10u) == std::vector<std::size_t>{ 0u, 2u, 5u, 7u }, "wrong rows of sample:4");
+
+	for (const auto rowCount : { std::size_t{ 1u }, std::size_t{ 7u }, std::size_t{ 1000u }, std::size_t{ 1u } << 40u }) {
+		for (const auto count : { std::size_t{ 1u }, std::size_t{ 3u }, std::size_t{ 7u }, std::size_t{ 999u } }) {
+			const auto rows = RowSelection{ RowMode::Sample, count }.GetRows(rowCount);
+
+			Check::That(rows.size() == std::min(count, rowCount), "sample gave a wrong number of rows");
+			Check::That(!rows.empty() && rows.front() == 0u, "sample does not start at the first row");
+			Check::That(std::adjacent_find(rows.begin(), rows.end(), std::greater_equal<>{}) == rows.end(),
+				"sample rows are not distinct and ascending");
+			Check::That(rows.back() < rowCount, "sample row is out of range");
+		}
+	}
+}
+
+int main() {
+	TestTableMatchesTabulate();
+	TestTableIgnoresLocaleAndThreads();
+	TestColumnWidths();
+	TestMismatchedColumnsAreRejected();
+	TestRowSelectionParse();
+	TestRowSelectionGetRows();
+	TestRowSelectionSample();
+
+	return Check::GetResult();
+}
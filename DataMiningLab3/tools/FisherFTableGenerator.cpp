@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "FisherF/FDistribution.hpp"
+#include "FisherF/FisherFTable.hpp"
+
+// Prints FisherFTable.hpp for the grid declared in it, every value from FDistribution::GetUpperQuantile.
+// Usage: FisherFTableGenerator > include/FisherF/FisherFTable.hpp
+//        FisherFTableGenerator --check    compares the compiled-in table with a fresh computation
+
+static constexpr int VALUES_PER_LINE = 8;
+static constexpr double CHECK_TOLERANCE = 1e-12;
+
+// k2 = infinity is extrapolated linearly in t = 1 / k2 from these two.
+static constexpr double LIMIT_K2 = 2e6;
+static constexpr double LIMIT_HALF_K2 = 1e6;
+
+static std::vector<double> GetRow(double alpha, int k1) {
+	const auto getValue = [&](double k2) {
+		return FDistribution(k1, k2).GetUpperQuantile(alpha);
+	};
+
+	std::vector<double> row;
+	row.reserve(FisherFTable::ROW_SIZE);
+
+	for (auto k2 = 1; k2 <= FisherFTable::MAX_DENSE_K2; ++k2) {
+		row.push_back(getValue(k2));
+	}
+
+	row.push_back(2.0 * getValue(LIMIT_K2) - getValue(LIMIT_HALF_K2));
+
+	for (auto i = 1; i < FisherFTable::TAIL_NODES; ++i) {
+		row.push_back(getValue(static_cast<double>(FisherFTable::MAX_DENSE_K2) * FisherFTable::TAIL_NODES / i));
+	}
+
+	return row;
+}
+
+static void PrintTable() {
+	std::printf(
+		"#pragma once\n"
+		"#include <array>\n"
+		"#include <cstddef>\n"
+		"\n"
+		"// Upper critical values F(alpha; k1, k2), P(F > x) = alpha, printed by tools/FisherFTableGenerator\n"
+		"// from FDistribution::GetUpperQuantile.\n"
+		"//\n"
+		"// One row of ROW_SIZE values per (alpha, k1), rows ordered by alpha, then by k1:\n"
+		"//   [0, MAX_DENSE_K2)                     k2 = 1 .. MAX_DENSE_K2;\n"
+		"//   [MAX_DENSE_K2, MAX_DENSE_K2 + TAIL)   node i at t = MAX_DENSE_K2 / k2 = i / TAIL_NODES,\n"
+		"//                                         node 0 (k2 = infinity) is 2 F(k1, 2e6) - F(k1, 1e6).\n"
+		"// Regenerate the file if any of the constants below or FDistribution changes, the FisherFTableIsCurrent test\n"
+		"// fails until then.\n"
+		"struct FisherFTable {\n"
+		"\tstatic constexpr std::array<double, %zu> ALPHAS = {", FisherFTable::ALPHAS.size());
+
+	for (std::size_t i = 0u; i < FisherFTable::ALPHAS.size(); ++i) {
+		std::printf("%s %.15g", i == 0u ? "" : ",", FisherFTable::ALPHAS[i]);
+	}
+
+	std::printf(
+		" };\n"
+		"\n"
+		"\tstatic constexpr int MAX_K1 = %d;\n"
+		"\tstatic constexpr int MAX_DENSE_K2 = %d;\n"
+		"\tstatic constexpr int TAIL_NODES = %d;\n"
+		"\n"
+		"\tstatic constexpr std::size_t ROW_SIZE = FisherFTable::MAX_DENSE_K2 + FisherFTable::TAIL_NODES;\n"
+		"\n"
+		"\tstatic constexpr std::array<double, FisherFTable::ALPHAS.size() * FisherFTable::MAX_K1 * FisherFTable::ROW_SIZE> VALUES = {\n",
+		FisherFTable::MAX_K1, FisherFTable::MAX_DENSE_K2, FisherFTable::TAIL_NODES);
+
+	for (std::size_t bucket = 0u; bucket < FisherFTable::ALPHAS.size(); ++bucket) {
+		for (auto k1 = 1; k1 <= FisherFTable::MAX_K1; ++k1) {
+			if (bucket != 0u || k1 != 1) {
+				std::printf("\n");
+			}
+
+			std::printf("\t\t// alpha = %.15g, k1 = %d\n", FisherFTable::ALPHAS[bucket], k1);
+
+			const auto row = GetRow(FisherFTable::ALPHAS[bucket], k1);
+
+			for (std::size_t i = 0u; i < row.size(); ++i) {
+				const auto first = i % VALUES_PER_LINE == 0u;
+				const auto last = i % VALUES_PER_LINE == VALUES_PER_LINE - 1u || i + 1u == row.size();
+
+				std::printf("%s%.15g,%s", first ? "\t\t" : " ", row[i], last ? "\n" : "");
+			}
+		}
+	}
+
+	std::printf("\t};\n};\n");
+}
+
+static int CheckTable() {
+	auto failures = 0;
+	auto worst = 0.0;
+
+	for (std::size_t bucket = 0u; bucket < FisherFTable::ALPHAS.size(); ++bucket) {
+		for (auto k1 = 1; k1 <= FisherFTable::MAX_K1; ++k1) {
+			const auto row = GetRow(FisherFTable::ALPHAS[bucket], k1);
+			const auto offset = (bucket * FisherFTable::MAX_K1 + static_cast<std::size_t>(k1 - 1)) * FisherFTable::ROW_SIZE;
+
+			for (std::size_t i = 0u; i < row.size(); ++i) {
+				const auto error = std::abs(FisherFTable::VALUES[offset + i] / row[i] - 1.0);
+				worst = std::max(worst, error);
+
+				if (!(error <= CHECK_TOLERANCE)) {
+					std::fprintf(stderr, "alpha %g, k1 %d, entry %zu: table %.15g, computed %.15g\n",
+						FisherFTable::ALPHAS[bucket], k1, i, FisherFTable::VALUES[offset + i], row[i]);
+					++failures;
+				}
+			}
+		}
+	}
+
+	std::printf("%zu values, worst relative difference %.2e\n", FisherFTable::VALUES.size(), worst);
+
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+int main(int argc, char* argv[]) {
+	if (argc > 1 && std::strcmp(argv[1], "--check") == 0) {
+		return CheckTable();
+	}
+
+	PrintTable();
+
+	return EXIT_SUCCESS;
+}